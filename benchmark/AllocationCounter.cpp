@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+// =============================================================================
+// Global operator new/delete replacements that count heap allocations.
+// =============================================================================
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "AllocationCounter.hpp"
+
+namespace
+{
+std::atomic<std::size_t> avoidAllocationCount{0};
+} // namespace
+
+auto globalAllocationCount() noexcept -> std::size_t
+{
+  return avoidAllocationCount.load(std::memory_order_relaxed);
+}
+
+auto operator new(std::size_t size) -> void*
+{
+  avoidAllocationCount.fetch_add(1, std::memory_order_relaxed);
+  if (void* pointer = std::malloc(size == 0 ? 1 : size))
+    return pointer;
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept
+{
+  std::free(pointer);
+}
@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+
+/**
+ * @brief Number of calls to the global operator new since program start.
+ *
+ * The benchmark executable replaces the global allocation functions (see
+ * AllocationCounter.cpp) so that benchmarks can report how many heap
+ * allocations each iteration performs.
+ */
+auto globalAllocationCount() noexcept -> std::size_t;
+
+/**
+ * @brief Reports heap allocations per iteration as the "allocs/iter" counter.
+ *
+ * @param state The running benchmark state.
+ * @param allocationsBefore globalAllocationCount() taken before the loop.
+ */
+inline void reportAllocationsPerIteration(
+    benchmark::State& state, std::size_t allocationsBefore)
+{
+  const auto allocations = globalAllocationCount() - allocationsBefore;
+  state.counters["allocs/iter"] = benchmark::Counter(
+      static_cast<double>(allocations),
+      benchmark::Counter::kAvgIterations);
+}
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+// =============================================================================
+// Category I: Batch Aggregation Benchmarks
+// Sums the successful results of a batch of divisions, one in 16 failing.
+// Compares: std::vector<Either<double, Error>> (rows interleave data, error
+// and tag) vs ropic::EitherColumn (contiguous doubles, errors aside)
+// =============================================================================
+
+#include <benchmark/benchmark.h>
+#include "ropic.hpp"
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace ropic;
+
+namespace
+{
+struct BatchError
+{
+  int code;
+  std::string message;
+};
+
+auto divide(long num, long den) -> Either<double, BatchError>
+{
+  if (den == 0)
+    return BatchError{1, "division by zero"};
+  return static_cast<double>(num) / static_cast<double>(den);
+}
+
+auto denominator(long i) -> long { return i % 16 == 0 ? 0 : i % 5 + 1; }
+} // namespace
+
+static void BM_Sum_VectorOfEither(benchmark::State &state)
+{
+  const auto rows = static_cast<long>(state.range(0));
+  std::vector<Either<double, BatchError>> results;
+  results.reserve(static_cast<std::size_t>(rows));
+  for (long i = 0; i < rows; ++i)
+    results.push_back(divide(i, denominator(i)));
+
+  for (auto _ : state)
+  {
+    double sum = 0.0;
+    for (const auto &result : results)
+      if (auto value = result.data())
+        sum += *value;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * rows);
+  state.SetLabel(std::to_string(sizeof(Either<double, BatchError>)) + " B/row");
+}
+
+static void BM_Sum_EitherColumn(benchmark::State &state)
+{
+  const auto rows = static_cast<long>(state.range(0));
+  EitherColumn<double, BatchError> results;
+  results.reserve(static_cast<std::size_t>(rows));
+  for (long i = 0; i < rows; ++i)
+    results.push_back(divide(i, denominator(i)));
+
+  for (auto _ : state)
+  {
+    auto values = results.values();
+    double sum = std::reduce(values.begin(), values.end());
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * rows);
+  state.SetLabel(std::to_string(sizeof(double)) + " B/row");
+}
+
+BENCHMARK(BM_Sum_VectorOfEither)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK(BM_Sum_EitherColumn)->Arg(1 << 12)->Arg(1 << 20);
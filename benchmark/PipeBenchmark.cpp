@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+// =============================================================================
+// Category J: Validation Chain Benchmarks
+// Runs a 10-step validation chain on a std::string field.
+// Compares: map/and_then combinators (an Either per step) vs ropic::pipe
+// (steps fused, a single Either at the end)
+// =============================================================================
+
+#include <benchmark/benchmark.h>
+#include "ropic.hpp"
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <utility>
+
+using namespace ropic;
+
+namespace
+{
+struct FieldError
+{
+  int code;
+  std::string message;
+};
+
+using Field = Either<std::string, FieldError>;
+
+auto trimLeft(std::string&& text) -> std::string
+{
+  text.erase(0, text.find_first_not_of(' '));
+  return std::move(text);
+}
+
+auto trimRight(std::string&& text) -> std::string
+{
+  text.erase(text.find_last_not_of(' ') + 1);
+  return std::move(text);
+}
+
+auto checkNotEmpty(std::string&& text) -> Field
+{
+  if (text.empty())
+    return FieldError{1, "empty"};
+  return std::move(text);
+}
+
+auto toLower(std::string&& text) -> std::string
+{
+  std::transform(
+      text.begin(),
+      text.end(),
+      text.begin(),
+      [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+  return std::move(text);
+}
+
+auto checkAscii(std::string&& text) -> Field
+{
+  for (char c : text)
+    if (static_cast<unsigned char>(c) > 127)
+      return FieldError{2, "not ascii"};
+  return std::move(text);
+}
+
+auto checkLength(std::string&& text) -> Field
+{
+  if (text.size() > 64)
+    return FieldError{3, "too long"};
+  return std::move(text);
+}
+
+auto collapseSpaces(std::string&& text) -> std::string
+{
+  text.erase(
+      std::unique(
+          text.begin(),
+          text.end(),
+          [](char a, char b) { return a == ' ' && b == ' '; }),
+      text.end());
+  return std::move(text);
+}
+
+auto checkNoDigits(std::string&& text) -> Field
+{
+  for (char c : text)
+    if (std::isdigit(static_cast<unsigned char>(c)) != 0)
+      return FieldError{4, "digits"};
+  return std::move(text);
+}
+
+auto replaceSpaces(std::string&& text) -> std::string
+{
+  std::replace(text.begin(), text.end(), ' ', '_');
+  return std::move(text);
+}
+
+auto checkReserved(std::string&& text) -> Field
+{
+  if (text == "admin")
+    return FieldError{5, "reserved"};
+  return std::move(text);
+}
+
+auto validateCombinators(std::string input) -> Field
+{
+  return Field{std::move(input)}
+      .map(trimLeft)
+      .map(trimRight)
+      .and_then(checkNotEmpty)
+      .map(toLower)
+      .and_then(checkAscii)
+      .and_then(checkLength)
+      .map(collapseSpaces)
+      .and_then(checkNoDigits)
+      .map(replaceSpaces)
+      .and_then(checkReserved);
+}
+
+const auto VALIDATE_PIPE = ropic::pipe(
+    trimLeft,
+    trimRight,
+    checkNotEmpty,
+    toLower,
+    checkAscii,
+    checkLength,
+    collapseSpaces,
+    checkNoDigits,
+    replaceSpaces,
+    checkReserved);
+
+auto validatePipe(std::string input) -> Field
+{
+  return VALIDATE_PIPE(Field{std::move(input)});
+}
+
+// Longer than the small-string buffer so every move steals a heap pointer
+const std::string VALID = "   Railway   Oriented   Programming   Field   ";
+const std::string INVALID = "   Railway   Oriented   Programming   Field 42 ";
+} // namespace
+
+static void BM_Validate_Combinators(benchmark::State &state)
+{
+  const std::string &input = state.range(0) == 0 ? VALID : INVALID;
+  for (auto _ : state)
+  {
+    auto result = validateCombinators(input);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Validate_Pipe(benchmark::State &state)
+{
+  const std::string &input = state.range(0) == 0 ? VALID : INVALID;
+  for (auto _ : state)
+  {
+    auto result = validatePipe(input);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Arg 0: valid field (all 10 steps); Arg 1: fails at step 8
+BENCHMARK(BM_Validate_Combinators)->Arg(0)->Arg(1);
+BENCHMARK(BM_Validate_Pipe)->Arg(0)->Arg(1);
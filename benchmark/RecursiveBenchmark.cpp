@@ -7,7 +7,10 @@
 // =============================================================================
 
 #include <benchmark/benchmark.h>
+#include "AllocationCounter.hpp"
 #include "ropic.hpp"
+#include <cstdint>
+#include <memory_resource>
 #include <string>
 #include <utility>
 
@@ -94,9 +97,103 @@ std::pair<int, std::string> recursiveIfElse(int depth, int errorAt) noexcept
   return result;
 }
 
+/// Error of recursiveValue; trivially copyable, unlike the std::string errors.
+enum class RecursionError : std::uint8_t
+{
+  FAILED,
+};
+
+/**
+ * @brief Recursive function returning a trivially copyable ValueEither.
+ *
+ * @param depth Controls the recursion depth (decrements toward 0)
+ * @param errorAt Specifies the depth at which an error occurs (decrements toward 0)
+ * @return ValueEither<int, RecursionError> Success with depth value, or error
+ */
+#if defined(_MSC_VER)
+__declspec(noinline)
+#else
+__attribute__((noinline))
+#endif
+ValueEither<int, RecursionError> recursiveValue(int depth, int errorAt) noexcept
+{
+  if (errorAt == 0)
+  {
+    return RecursionError::FAILED;
+  }
+  if (depth == 0)
+  {
+    return depth;
+  }
+  auto result = recursiveValue(depth - 1, errorAt - 1);
+  if (result.error())
+  {
+    return *result.error();
+  }
+  return result;
+}
+
+/**
+ * @brief Recursive function composing value-mode Eithers with map.
+ *
+ * Same results and error type as recursiveCoawait, without coroutine frames.
+ *
+ * @param depth Controls the recursion depth (decrements toward 0)
+ * @param errorAt Specifies the depth at which an error occurs (decrements toward 0)
+ * @return Either<int, std::string> Success with depth value, or error string
+ */
+#if defined(_MSC_VER)
+__declspec(noinline)
+#else
+__attribute__((noinline))
+#endif
+Either<int, std::string> recursiveCombinator(int depth, int errorAt) noexcept
+{
+  if (errorAt == 0)
+  {
+    return "Error at depth " + std::to_string(depth);
+  }
+  if (depth == 0)
+  {
+    return depth;
+  }
+  return recursiveCombinator(depth - 1, errorAt - 1)
+      .map([](int result) { return result; });
+}
+
+/**
+ * @brief Recursive plain function propagating errors with ROPIC_TRY_ASSIGN.
+ *
+ * Same results and error type as recursiveCoawait, without coroutine frames.
+ * ROPIC_TRY_ASSIGN is the portable spelling of ROPIC_TRY.
+ *
+ * @param depth Controls the recursion depth (decrements toward 0)
+ * @param errorAt Specifies the depth at which an error occurs (decrements toward 0)
+ * @return Either<int, std::string> Success with depth value, or error string
+ */
+#if defined(_MSC_VER)
+__declspec(noinline)
+#else
+__attribute__((noinline))
+#endif
+Either<int, std::string> recursiveTry(int depth, int errorAt) noexcept
+{
+  if (errorAt == 0)
+  {
+    return "Error at depth " + std::to_string(depth);
+  }
+  if (depth == 0)
+  {
+    return depth;
+  }
+  ROPIC_TRY_ASSIGN(int result, recursiveTry(depth - 1, errorAt - 1));
+  return result;
+}
+
 // =============================================================================
 // Benchmark: Success Path (no errors)
-// Grouped by depth: Coawait/N -> Throw/N -> IfElse/N
+// Grouped by depth: Coawait/N -> Value/N -> Combinator/N -> Try/N -> Throw/N
+// -> IfElse/N
 // =============================================================================
 
 static void BM_Recursive_Coawait_Success(benchmark::State &state)
@@ -104,11 +201,88 @@ static void BM_Recursive_Coawait_Success(benchmark::State &state)
   const int depth = static_cast<int>(state.range(0));
   const int errorAt = depth + 100; // Never triggers error
 
+  const auto allocationsBefore = globalAllocationCount();
+  for (auto _ : state)
+  {
+    auto result = recursiveCoawait(depth, errorAt);
+    benchmark::DoNotOptimize(result);
+  }
+  reportAllocationsPerIteration(state, allocationsBefore);
+  state.SetItemsProcessed(state.iterations() * depth);
+}
+
+#if ROPIC_FRAME_POOL
+/**
+ * @brief Same as BM_Recursive_Coawait_Success, but empties the frame pool
+ * before every iteration so each frame goes to the global heap, as it does
+ * with ROPIC_FRAME_POOL=0. Compare "allocs/iter" with the pooled benchmark.
+ */
+static void BM_Recursive_Coawait_ColdPool_Success(benchmark::State &state)
+{
+  const int depth = static_cast<int>(state.range(0));
+  const int errorAt = depth + 100; // Never triggers error
+
+  const auto allocationsBefore = globalAllocationCount();
   for (auto _ : state)
   {
+    detail::FramePool::local().release();
     auto result = recursiveCoawait(depth, errorAt);
     benchmark::DoNotOptimize(result);
   }
+  reportAllocationsPerIteration(state, allocationsBefore);
+  state.SetItemsProcessed(state.iterations() * depth);
+}
+#endif
+
+/**
+ * @brief recursiveValue returns ValueEither<int, RecursionError> in registers;
+ * compare with the std::pair<int, std::string> of recursiveIfElse.
+ */
+static void BM_Recursive_Value_Success(benchmark::State &state)
+{
+  const int depth = static_cast<int>(state.range(0));
+  const int errorAt = depth + 100; // Never triggers error
+
+  for (auto _ : state)
+  {
+    auto result = recursiveValue(depth, errorAt);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * depth);
+}
+
+/**
+ * @brief recursiveCombinator chains value-mode Eithers with map instead of
+ * co_await; same std::string error as recursiveCoawait and recursiveIfElse.
+ */
+static void BM_Recursive_Combinator_Success(benchmark::State &state)
+{
+  const int depth = static_cast<int>(state.range(0));
+  const int errorAt = depth + 100; // Never triggers error
+
+  for (auto _ : state)
+  {
+    auto result = recursiveCombinator(depth, errorAt);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * depth);
+}
+
+/**
+ * @brief recursiveTry propagates errors from a plain function with
+ * ROPIC_TRY_ASSIGN; same std::string error as recursiveCoawait and
+ * recursiveIfElse.
+ */
+static void BM_Recursive_Try_Success(benchmark::State &state)
+{
+  const int depth = static_cast<int>(state.range(0));
+  const int errorAt = depth + 100; // Never triggers error
+
+  for (auto _ : state)
+  {
+    auto result = recursiveTry(depth, errorAt);
+    benchmark::DoNotOptimize(result);
+  }
   state.SetItemsProcessed(state.iterations() * depth);
 }
 
@@ -146,27 +320,125 @@ static void BM_Recursive_IfElse_Success(benchmark::State &state)
   state.SetItemsProcessed(state.iterations() * depth);
 }
 
-// Register grouped by depth: Coawait/10 -> Throw/10 -> IfElse/10 -> Coawait/50 -> ...
+// Register grouped by depth: Coawait/10 -> ColdPool/10 -> Value/10
+// -> Combinator/10 -> Try/10 -> Throw/10 -> IfElse/10 -> Coawait/50 -> ...
 BENCHMARK(BM_Recursive_Coawait_Success)->Arg(10)->Unit(benchmark::kMicrosecond);
+#if ROPIC_FRAME_POOL
+BENCHMARK(BM_Recursive_Coawait_ColdPool_Success)->Arg(10)->Unit(benchmark::kMicrosecond);
+#endif
+BENCHMARK(BM_Recursive_Value_Success)->Arg(10)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Combinator_Success)->Arg(10)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Try_Success)->Arg(10)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_Recursive_Throw_Success)->Arg(10)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_Recursive_IfElse_Success)->Arg(10)->Unit(benchmark::kMicrosecond);
 
 BENCHMARK(BM_Recursive_Coawait_Success)->Arg(50)->Unit(benchmark::kMicrosecond);
+#if ROPIC_FRAME_POOL
+BENCHMARK(BM_Recursive_Coawait_ColdPool_Success)->Arg(50)->Unit(benchmark::kMicrosecond);
+#endif
+BENCHMARK(BM_Recursive_Value_Success)->Arg(50)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Combinator_Success)->Arg(50)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Try_Success)->Arg(50)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_Recursive_Throw_Success)->Arg(50)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_Recursive_IfElse_Success)->Arg(50)->Unit(benchmark::kMicrosecond);
 
 BENCHMARK(BM_Recursive_Coawait_Success)->Arg(100)->Unit(benchmark::kMicrosecond);
+#if ROPIC_FRAME_POOL
+BENCHMARK(BM_Recursive_Coawait_ColdPool_Success)->Arg(100)->Unit(benchmark::kMicrosecond);
+#endif
+BENCHMARK(BM_Recursive_Value_Success)->Arg(100)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Combinator_Success)->Arg(100)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Try_Success)->Arg(100)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_Recursive_Throw_Success)->Arg(100)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_Recursive_IfElse_Success)->Arg(100)->Unit(benchmark::kMicrosecond);
 
 BENCHMARK(BM_Recursive_Coawait_Success)->Arg(200)->Unit(benchmark::kMicrosecond);
+#if ROPIC_FRAME_POOL
+BENCHMARK(BM_Recursive_Coawait_ColdPool_Success)->Arg(200)->Unit(benchmark::kMicrosecond);
+#endif
+BENCHMARK(BM_Recursive_Value_Success)->Arg(200)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Combinator_Success)->Arg(200)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Try_Success)->Arg(200)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_Recursive_Throw_Success)->Arg(200)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_Recursive_IfElse_Success)->Arg(200)->Unit(benchmark::kMicrosecond);
 
 BENCHMARK(BM_Recursive_Coawait_Success)->Arg(300)->Unit(benchmark::kMicrosecond);
+#if ROPIC_FRAME_POOL
+BENCHMARK(BM_Recursive_Coawait_ColdPool_Success)->Arg(300)->Unit(benchmark::kMicrosecond);
+#endif
+BENCHMARK(BM_Recursive_Value_Success)->Arg(300)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Combinator_Success)->Arg(300)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Try_Success)->Arg(300)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_Recursive_Throw_Success)->Arg(300)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_Recursive_IfElse_Success)->Arg(300)->Unit(benchmark::kMicrosecond);
 
+// =============================================================================
+// Benchmark: Frame Memory Resources (success path)
+// recursiveCoawait with frames routed to a std::pmr::memory_resource
+// Grouped by depth: SyncPool/N -> UnsyncPool/N -> Monotonic/N
+// =============================================================================
+
+static void BM_Recursive_Coawait_SyncPool_Success(benchmark::State &state)
+{
+  const int depth = static_cast<int>(state.range(0));
+  const int errorAt = depth + 100; // Never triggers error
+
+  std::pmr::synchronized_pool_resource resource;
+  FrameResourceScope scope{&resource};
+  for (auto _ : state)
+  {
+    auto result = recursiveCoawait(depth, errorAt);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * depth);
+}
+
+static void BM_Recursive_Coawait_UnsyncPool_Success(benchmark::State &state)
+{
+  const int depth = static_cast<int>(state.range(0));
+  const int errorAt = depth + 100; // Never triggers error
+
+  std::pmr::unsynchronized_pool_resource resource;
+  FrameResourceScope scope{&resource};
+  for (auto _ : state)
+  {
+    auto result = recursiveCoawait(depth, errorAt);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * depth);
+}
+
+static void BM_Recursive_Coawait_Monotonic_Success(benchmark::State &state)
+{
+  const int depth = static_cast<int>(state.range(0));
+  const int errorAt = depth + 100; // Never triggers error
+
+  std::pmr::monotonic_buffer_resource resource;
+  for (auto _ : state)
+  {
+    {
+      FrameResourceScope scope{&resource};
+      auto result = recursiveCoawait(depth, errorAt);
+      benchmark::DoNotOptimize(result);
+    }
+    resource.release(); // Request-scoped: drop every frame at once
+  }
+  state.SetItemsProcessed(state.iterations() * depth);
+}
+
+// Register grouped by depth
+BENCHMARK(BM_Recursive_Coawait_SyncPool_Success)->Arg(10)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Coawait_UnsyncPool_Success)->Arg(10)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Coawait_Monotonic_Success)->Arg(10)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Recursive_Coawait_SyncPool_Success)->Arg(100)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Coawait_UnsyncPool_Success)->Arg(100)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Coawait_Monotonic_Success)->Arg(100)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Recursive_Coawait_SyncPool_Success)->Arg(300)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Coawait_UnsyncPool_Success)->Arg(300)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Coawait_Monotonic_Success)->Arg(300)->Unit(benchmark::kMicrosecond);
+
 // =============================================================================
 // Benchmark: Early Error (error at 10% depth)
 // Grouped by depth: Coawait/N -> Throw/N -> IfElse/N
@@ -233,7 +505,8 @@ BENCHMARK(BM_Recursive_IfElse_EarlyError)->Arg(300)->Unit(benchmark::kMicrosecon
 
 // =============================================================================
 // Benchmark: Mid Error (error at 50% depth)
-// Grouped by depth: Coawait/N -> Throw/N -> IfElse/N
+// Grouped by depth: Coawait/N -> Value/N -> Combinator/N -> Try/N -> Throw/N
+// -> IfElse/N
 // =============================================================================
 
 static void BM_Recursive_Coawait_MidError(benchmark::State &state)
@@ -249,6 +522,45 @@ static void BM_Recursive_Coawait_MidError(benchmark::State &state)
   state.SetItemsProcessed(state.iterations() * errorAt);
 }
 
+static void BM_Recursive_Value_MidError(benchmark::State &state)
+{
+  const int depth = static_cast<int>(state.range(0));
+  const int errorAt = depth / 2; // Error at 50% depth
+
+  for (auto _ : state)
+  {
+    auto result = recursiveValue(depth, errorAt);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * errorAt);
+}
+
+static void BM_Recursive_Combinator_MidError(benchmark::State &state)
+{
+  const int depth = static_cast<int>(state.range(0));
+  const int errorAt = depth / 2; // Error at 50% depth
+
+  for (auto _ : state)
+  {
+    auto result = recursiveCombinator(depth, errorAt);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * errorAt);
+}
+
+static void BM_Recursive_Try_MidError(benchmark::State &state)
+{
+  const int depth = static_cast<int>(state.range(0));
+  const int errorAt = depth / 2; // Error at 50% depth
+
+  for (auto _ : state)
+  {
+    auto result = recursiveTry(depth, errorAt);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * errorAt);
+}
+
 static void BM_Recursive_Throw_MidError(benchmark::State &state)
 {
   const int depth = static_cast<int>(state.range(0));
@@ -284,14 +596,23 @@ static void BM_Recursive_IfElse_MidError(benchmark::State &state)
 
 // Register grouped by depth
 BENCHMARK(BM_Recursive_Coawait_MidError)->Arg(100)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Value_MidError)->Arg(100)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Combinator_MidError)->Arg(100)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Try_MidError)->Arg(100)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_Recursive_Throw_MidError)->Arg(100)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_Recursive_IfElse_MidError)->Arg(100)->Unit(benchmark::kMicrosecond);
 
 BENCHMARK(BM_Recursive_Coawait_MidError)->Arg(200)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Value_MidError)->Arg(200)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Combinator_MidError)->Arg(200)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Try_MidError)->Arg(200)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_Recursive_Throw_MidError)->Arg(200)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_Recursive_IfElse_MidError)->Arg(200)->Unit(benchmark::kMicrosecond);
 
 BENCHMARK(BM_Recursive_Coawait_MidError)->Arg(300)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Value_MidError)->Arg(300)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Combinator_MidError)->Arg(300)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Recursive_Try_MidError)->Arg(300)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_Recursive_Throw_MidError)->Arg(300)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_Recursive_IfElse_MidError)->Arg(300)->Unit(benchmark::kMicrosecond);
 
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+// =============================================================================
+// Category H: Container Growth Benchmarks
+// Fills a batch of value-mode Eithers without reserving, so growth
+// reallocations dominate. std::vector runs the Either move constructor and
+// destructor per element and reallocation; ropic::RelocatingVector copies
+// the buffer with memcpy when the payloads are trivially relocatable.
+// =============================================================================
+
+#include <benchmark/benchmark.h>
+#include "ropic.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace ropic;
+
+namespace
+{
+enum class LoadError : std::uint8_t
+{
+  MISSING,
+};
+
+struct Row
+{
+  std::unique_ptr<long> value;
+  long key;
+};
+
+using RowResult = Either<Row, LoadError>;
+
+auto makeRow(long key) -> RowResult
+{
+  if (key % 64 == 0)
+    return LoadError::MISSING;
+  return Row{nullptr, key};
+}
+
+template <typename CONTAINER>
+void fillBatch(benchmark::State &state)
+{
+  const auto batch = static_cast<long>(state.range(0));
+  for (auto _ : state)
+  {
+    CONTAINER results;
+    for (long key = 0; key < batch; ++key)
+      results.push_back(makeRow(key));
+    benchmark::DoNotOptimize(results.data());
+  }
+  state.SetItemsProcessed(state.iterations() * batch);
+}
+} // namespace
+
+template <>
+struct ropic::is_trivially_relocatable<Row> : std::true_type
+{
+};
+
+static void BM_Grow_StdVector(benchmark::State &state)
+{
+  fillBatch<std::vector<RowResult>>(state);
+}
+
+static void BM_Grow_RelocatingVector(benchmark::State &state)
+{
+  fillBatch<RelocatingVector<RowResult>>(state);
+}
+
+BENCHMARK(BM_Grow_StdVector)->Arg(1 << 10)->Arg(1 << 18);
+BENCHMARK(BM_Grow_RelocatingVector)->Arg(1 << 10)->Arg(1 << 18);
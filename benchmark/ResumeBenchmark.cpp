@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+// =============================================================================
+// Category G: Suspended Population Benchmarks
+// Resumes a large population of suspended Either coroutines in random order,
+// the access pattern of a server completing I/O for many requests at once.
+//
+// BM_Move_Pending_* shuffle the pending results themselves between
+// containers: an Either rebinds its promise on every move, an AsyncEither
+// copies one pointer.
+//
+// Frame memory locality dominates the resume benchmark. Compare builds with and without
+// -DROPIC_ENABLE_FRAME_HUGE_PAGES=ON and read dTLB misses through libpfm:
+//
+//   ropic-benchmarks --benchmark_filter=BM_Resume \
+//       --benchmark_perf_counters=PERF_COUNT_HW_CACHE_DTLB:READ:MISS
+// =============================================================================
+
+#include <benchmark/benchmark.h>
+#include "ropic.hpp"
+#include <algorithm>
+#include <array>
+#include <coroutine>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ropic;
+
+namespace
+{
+/// Foreign awaitable that parks the coroutine until the benchmark resumes it.
+struct Parked
+{
+  std::vector<std::coroutine_handle<>>* handles;
+
+  [[nodiscard]]
+  auto await_ready() const noexcept -> bool
+  {
+    return false;
+  }
+  void await_suspend(std::coroutine_handle<> handle)
+  {
+    handles->push_back(handle);
+  }
+  void await_resume() const noexcept {}
+};
+
+/**
+ * @brief Suspends once; the scratch array lives in the frame across the
+ * suspension, so resuming touches the frame memory.
+ */
+Either<long, std::string>
+parkedWork(long seed, std::vector<std::coroutine_handle<>>& handles)
+{
+  std::array<long, 8> scratch{};
+  std::iota(scratch.begin(), scratch.end(), seed);
+  co_await Parked{&handles};
+  co_return std::accumulate(scratch.begin(), scratch.end(), 0L);
+}
+
+/// Same as parkedWork(), with the result kept in the frame.
+AsyncEither<long, std::string>
+parkedAsyncWork(long seed, std::vector<std::coroutine_handle<>>& handles)
+{
+  std::array<long, 8> scratch{};
+  std::iota(scratch.begin(), scratch.end(), seed);
+  co_await Parked{&handles};
+  co_return std::accumulate(scratch.begin(), scratch.end(), 0L);
+}
+
+/**
+ * @brief Moves a population of pending results back and forth between two
+ * vectors in random order, then completes them.
+ */
+template <typename RESULT, typename WORK>
+void movePending(benchmark::State &state, WORK work)
+{
+  const auto population = static_cast<std::size_t>(state.range(0));
+  std::vector<RESULT> from;
+  std::vector<RESULT> to;
+  std::vector<std::coroutine_handle<>> handles;
+  std::vector<std::size_t> order(population);
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  std::shuffle(order.begin(), order.end(), std::mt19937_64{42});
+  from.reserve(population);
+  to.reserve(population);
+  handles.reserve(population);
+  for (std::size_t i = 0; i < population; ++i)
+    from.push_back(work(static_cast<long>(i), handles));
+
+  for (auto _ : state)
+  {
+    to.clear();
+    for (const std::size_t index : order)
+      to.push_back(std::move(from[index]));
+    std::swap(from, to);
+    benchmark::DoNotOptimize(from.data());
+  }
+  state.SetItemsProcessed(
+      state.iterations() * static_cast<std::int64_t>(population));
+
+  for (auto handle : handles)
+    handle.resume();
+}
+} // namespace
+
+static void BM_Resume_Suspended_RandomOrder(benchmark::State &state)
+{
+  const auto population = static_cast<std::size_t>(state.range(0));
+  std::vector<Either<long, std::string>> eithers;
+  std::vector<std::coroutine_handle<>> handles;
+  eithers.reserve(population);
+  handles.reserve(population);
+  std::mt19937_64 random{42};
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    eithers.clear();
+    handles.clear();
+    for (std::size_t i = 0; i < population; ++i)
+      eithers.push_back(parkedWork(static_cast<long>(i), handles));
+    std::shuffle(handles.begin(), handles.end(), random);
+    state.ResumeTiming();
+
+    for (auto handle : handles)
+      handle.resume();
+    benchmark::DoNotOptimize(eithers.data());
+  }
+  state.SetItemsProcessed(
+      state.iterations() * static_cast<std::int64_t>(population));
+  state.SetLabel(ROPIC_FRAME_HUGE_PAGES ? "huge-page slabs" : "heap blocks");
+}
+
+BENCHMARK(BM_Resume_Suspended_RandomOrder)
+    ->Arg(1 << 12)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_Move_Pending_Either(benchmark::State &state)
+{
+  movePending<Either<long, std::string>>(state, &parkedWork);
+}
+
+static void BM_Move_Pending_Async(benchmark::State &state)
+{
+  movePending<AsyncEither<long, std::string>>(state, &parkedAsyncWork);
+}
+
+BENCHMARK(BM_Move_Pending_Either)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK(BM_Move_Pending_Async)->Arg(1 << 12)->Arg(1 << 16);
@@ -3,10 +3,18 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include <ropic.hpp>
 
 #include "Error.hpp"
 
+/// Errors are rare: keep them out of line so Result<int> stays pointer-sized.
+template <>
+struct ropic::box_error<Error> : std::true_type
+{
+};
+
 /// @brief Type alias for Either<DATA, Error> for convenience.
 template <typename DATA>
 using Result = ropic::Either<DATA, Error>;
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <coroutine>
+#include <type_traits>
+
+namespace ropic::detail
+{
+template <typename DATA, typename ERROR>
+class AsyncEitherImpl;
+
+/**
+ * @brief Resumption point of a coroutine awaiting a pending AsyncEitherImpl.
+ *
+ * The awaiter registers itself with the awaited promise and suspends. The
+ * thread publishing the result then calls `resume`, which returns `awaiting`
+ * to continue with the data, or propagates the error and returns the
+ * coroutine to transfer to instead.
+ */
+struct AsyncContinuation
+{
+  /// Called once the awaited result is published.
+  std::coroutine_handle<> (*resume)(AsyncContinuation& self) noexcept =
+      nullptr;
+
+  /// The suspended awaiting coroutine.
+  std::coroutine_handle<> awaiting;
+};
+
+/// Base of awaiters whose operand is always finished.
+struct NoContinuation
+{
+};
+
+/// True for the AsyncEitherImpl operands that may still be pending.
+template <typename SOURCE>
+inline constexpr bool is_async_either_v = false;
+
+template <typename DATA, typename ERROR>
+inline constexpr bool is_async_either_v<AsyncEitherImpl<DATA, ERROR>> = true;
+
+/// AsyncContinuation for awaiters of an AsyncEitherImpl, else empty.
+template <typename SOURCE>
+using ContinuationFor = std::conditional_t<
+    is_async_either_v<SOURCE>,
+    AsyncContinuation,
+    NoContinuation>;
+} // namespace ropic::detail
@@ -0,0 +1,290 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <cassert>
+#include <coroutine>
+#include <type_traits>
+#include <utility>
+
+#include "async_continuation.hpp"
+#include "attributes.hpp"
+#include "borrower.hpp"
+#include "either_concept.hpp"
+#include "either_impl.hpp"
+#include "error_box.hpp"
+#include "relocation.hpp"
+#include "void.hpp"
+
+namespace ropic::detail
+{
+/**
+ * @class AsyncEitherImpl
+ * @brief Either whose result lives in its coroutine frame.
+ *
+ * @tparam DATA The success value type (must satisfy detail::plain_value_type)
+ * @tparam ERROR The error type (must satisfy detail::plain_value_type). Must
+ * differ from DATA.
+ *
+ * EitherImpl keeps its result in the returned object, so the promise points
+ * back at it and every move of a pending EitherImpl rebinds the promise.
+ * AsyncEitherImpl is only the owning coroutine handle: the result is written
+ * into the promise, and a move copies one pointer. In exchange there is no
+ * value mode, and the frame is kept until the AsyncEitherImpl is destroyed or
+ * its payload is taken.
+ *
+ * The coroutine starts eagerly. Once it has a result it stays suspended, at
+ * final_suspend after `co_return` or at the `co_await` that propagated an
+ * error. done() may be polled from a thread other than the one finishing the
+ * coroutine: it turns true only once the coroutine is suspended for good, so
+ * the AsyncEitherImpl may be destroyed as soon as it does. A coroutine
+ * awaiting it while pending is suspended and resumed by the thread that
+ * finishes it; only one coroutine may wait for it at a time.
+ *
+ * @warning The `data()` and `error()` methods return Borrower pointers that
+ * become dangling after the AsyncEitherImpl object is destroyed.
+ */
+template <typename DATA, typename ERROR>
+class ROPIC_CORO_AWAIT_ELIDABLE AsyncEitherImpl
+{
+  static_assert(
+      either_concept<DATA, ERROR>,
+      "`DATA` and `ERROR` must not be identical and not be reference, const, "
+      "void or monostate types");
+  // ==========================================
+  // PRIVATE NESTED TYPES
+  // ==========================================
+  class Promise;
+
+  /// Awaiter for EitherImpl, ValueEither or AsyncEitherImpl composition.
+  /// Propagates errors, extracts values.
+  template <typename OTHER, bool IS_LVALUE, typename SOURCE>
+  class PropagatingAwaiter;
+
+  using Handle = std::coroutine_handle<Promise>;
+
+  /// ERROR itself, or its ErrorBox when ropic::box_error opts it in.
+  using Stored = StoredError<ERROR>;
+
+  template <typename OTHER_DATA, typename OTHER_ERROR>
+  friend class EitherImpl;
+
+  template <typename OTHER_DATA, typename OTHER_ERROR>
+  friend class AsyncEitherImpl;
+
+  // ==========================================
+  // PRIVATE VARIABLES & FUNCTIONS
+  // ==========================================
+  /// Owns the frame holding the result; null when empty (moved-from, taken).
+  Handle _handle;
+
+  explicit AsyncEitherImpl(Handle h) noexcept : _handle(h) {}
+
+  /// @brief Returns the result alternative `T`, or nullptr if it is not held
+  /// or the coroutine is still running.
+  template <typename T>
+  [[nodiscard]]
+  auto _result() const noexcept -> T*
+  {
+    if (!_handle || !_handle.promise().done())
+      return nullptr;
+    return _handle.promise().template result<T>();
+  }
+
+  /// @brief Returns the stored error (or its box), or nullptr.
+  [[nodiscard]]
+  auto _storedError() noexcept -> Stored*
+  {
+    return _result<Stored>();
+  }
+
+  /// @brief Returns the stored error of an EitherImpl, SyncEitherImpl or
+  /// AsyncEitherImpl.
+  template <typename SOURCE>
+  [[nodiscard]]
+  static auto _storedErrorOf(SOURCE& source) noexcept -> Stored*
+  {
+    return source._storedError();
+  }
+
+  /// @brief Registers `continuation` to run once the result is published.
+  /// @return false if it already is; the caller goes on without waiting.
+  [[nodiscard]]
+  auto _park(AsyncContinuation& continuation) noexcept -> bool
+  {
+    assert(_handle && "AsyncEitherImpl must not be empty");
+    return _handle.promise().park(continuation);
+  }
+
+  /// @brief Destroys the frame and leaves the AsyncEitherImpl empty.
+  void _release() noexcept
+  {
+    if (_handle)
+      std::exchange(_handle, nullptr).destroy();
+  }
+
+public:
+  using promise_type = Promise;
+
+  // ==========================================
+  // CONSTRUCTORS, DESTRUCTOR, OPERATORS
+  // ==========================================
+
+  /// @brief Copy disabled; use move semantics.
+  AsyncEitherImpl(const AsyncEitherImpl&) = delete;
+
+  /// @brief Copy disabled; use move semantics.
+  auto operator=(const AsyncEitherImpl&) -> AsyncEitherImpl& = delete;
+
+  /// @brief Destroys the frame, and the result with it.
+  ~AsyncEitherImpl() noexcept { _release(); }
+
+  /// @brief Move constructor; transfers ownership of the frame.
+  AsyncEitherImpl(AsyncEitherImpl&& other) noexcept
+      : _handle(std::exchange(other._handle, nullptr))
+  {
+  }
+
+  /// @brief Move assignment operator; destroys the frame currently owned.
+  auto operator=(AsyncEitherImpl&& other) noexcept -> AsyncEitherImpl&
+  {
+    if (this != &other)
+    {
+      _release();
+      _handle = std::exchange(other._handle, nullptr);
+    }
+    return *this;
+  }
+
+  // ==========================================
+  // ACCESSORS
+  // ==========================================
+
+  /**
+   * @brief Returns optional reference to error if present, empty Borrower
+   * otherwise.
+   * @warning Returned Borrower becomes dangling after AsyncEitherImpl is
+   * destroyed.
+   */
+  [[nodiscard]]
+  auto error() noexcept -> Borrower<ERROR>
+  {
+    return Borrower<ERROR>{unboxError<ERROR>(_result<Stored>())};
+  }
+
+  /// @copydoc error()
+  [[nodiscard]]
+  auto error() const noexcept -> Borrower<const ERROR>
+  {
+    return Borrower<const ERROR>{
+        unboxError<ERROR>(static_cast<const Stored*>(_result<Stored>()))};
+  }
+
+  /**
+   * @brief Returns optional reference to data if present, empty Borrower
+   * otherwise.
+   * @warning Returned Borrower becomes dangling after AsyncEitherImpl is
+   * destroyed.
+   */
+  [[nodiscard]]
+  auto data() noexcept -> Borrower<DATA>
+  {
+    return Borrower<DATA>{_result<DATA>()};
+  }
+
+  /// @copydoc data()
+  [[nodiscard]]
+  auto data() const noexcept -> Borrower<const DATA>
+  {
+    return Borrower<const DATA>{_result<DATA>()};
+  }
+
+  /**
+   * @brief Moves the data out, frees the frame and leaves the
+   * AsyncEitherImpl empty.
+   * @pre data() is not empty.
+   */
+  [[nodiscard]]
+  auto takeData() && noexcept(std::is_nothrow_move_constructible_v<DATA>)
+      -> DATA
+  {
+    DATA* data = _result<DATA>();
+    assert(data && "AsyncEitherImpl must contain data");
+    DATA value(std::move(*data));
+    _release();
+    return value;
+  }
+
+  /**
+   * @brief Moves the error out, frees the frame and leaves the
+   * AsyncEitherImpl empty.
+   * @pre error() is not empty.
+   */
+  [[nodiscard]]
+  auto takeError() && noexcept(std::is_nothrow_move_constructible_v<ERROR>)
+      -> ERROR
+  {
+    ERROR* error = unboxError<ERROR>(_result<Stored>());
+    assert(error && "AsyncEitherImpl must contain an error");
+    ERROR value(std::move(*error));
+    _release();
+    return value;
+  }
+
+  /**
+   * @brief Returns true if the AsyncEitherImpl contains a result (data or
+   * error). Returns false while the coroutine is suspended and once empty.
+   */
+  [[nodiscard]]
+  auto done() const noexcept -> bool
+  {
+    return _handle && _handle.promise().done();
+  }
+};
+} // namespace ropic::detail
+
+namespace ropic
+{
+/// An AsyncEitherImpl is a bare frame pointer; nothing refers back to it.
+template <typename DATA, typename ERROR>
+struct is_trivially_relocatable<detail::AsyncEitherImpl<DATA, ERROR>>
+    : std::true_type
+{
+};
+
+/**
+ * @brief Either returned as a single owning handle, its result kept in the
+ * coroutine frame.
+ *
+ * Prefer it over Either for coroutines that suspend on foreign awaitables
+ * and whose pending results are moved around, e.g. between containers: a
+ * move is one pointer copy instead of a result move plus a promise update.
+ * Either stays the better choice for synchronous code, where its frame is
+ * freed as soon as the result is set.
+ *
+ * Either and AsyncEither coroutines await it like an Either. While it is
+ * still pending, the awaiting coroutine suspends and is resumed by whichever
+ * thread finishes it.
+ *
+ * @code
+ * AsyncEither<double, Error> divideLater(std::string num, std::string den) {
+ *     std::string fetched = co_await AsyncFetch{std::move(num)};
+ *     co_return co_await divideStr(fetched, den);
+ * }
+ *
+ * std::list<AsyncEither<double, Error>> tasks;
+ * tasks.push_back(divideLater("42", "7")); // Moves one pointer
+ * @endcode
+ *
+ * @see detail::AsyncEitherImpl for implementation details.
+ */
+template <typename DATA, typename ERROR>
+using AsyncEither = std::conditional_t<
+    std::is_same_v<DATA, void>,
+    detail::AsyncEitherImpl<Void, ERROR>,
+    detail::AsyncEitherImpl<DATA, ERROR>>;
+} // namespace ropic
+
+#include "async_either_awaiters.inl"
+#include "async_either_promise.inl"
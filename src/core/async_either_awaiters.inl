@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <cassert>
+#include <coroutine>
+#include <type_traits>
+#include <utility>
+
+#include "async_continuation.hpp"
+#include "async_either.hpp"
+#include "value_either.hpp"
+#include "void.hpp"
+
+namespace ropic::detail
+{
+/**
+ * @brief Awaiter propagating errors out of an AsyncEither coroutine.
+ *
+ * Used when co_await-ing an EitherImpl, ValueEither, SyncEitherImpl or
+ * AsyncEitherImpl with the same ERROR inside an AsyncEitherImpl<DATA, ERROR>
+ * coroutine. On error: stores it as the result and leaves the coroutine
+ * suspended for good; its frame is freed with the AsyncEitherImpl. On
+ * success: extracts and returns the data value. A pending AsyncEitherImpl is
+ * waited for: the coroutine suspends until its result is published.
+ */
+template <typename DATA, typename ERROR>
+template <typename OTHER, bool IS_LVALUE, typename SOURCE>
+class AsyncEitherImpl<DATA, ERROR>::PropagatingAwaiter
+    : ContinuationFor<SOURCE>
+{
+  std::conditional_t<IS_LVALUE, SOURCE&, SOURCE&&> _awaitableEither;
+  Promise& _promise;
+
+  /// Errors of an awaited EitherImpl, SyncEitherImpl or AsyncEitherImpl
+  /// temporary are handed over in their stored form, so boxed errors move
+  /// without a new allocation. An lvalue keeps its box, holding the
+  /// moved-from error.
+  ///
+  /// The coroutine is suspended here, but this awaiter lives in its frame:
+  /// the result is published last, once nothing of the frame is used.
+  auto _propagate() noexcept(std::is_nothrow_move_assignable_v<ERROR>)
+      -> std::coroutine_handle<>
+  {
+    Promise& promise = _promise;
+    if constexpr (
+        !IS_LVALUE && !std::is_same_v<SOURCE, ValueEither<OTHER, ERROR>>)
+    {
+      Stored* stored = _storedErrorOf(_awaitableEither);
+      assert(stored && "`await_suspend` must be called with error state");
+
+      promise.takeError(*stored);
+    }
+    else
+    {
+      auto err = _awaitableEither.error();
+      assert(err && "`await_suspend` must be called with error state");
+
+      promise.setError(std::move(*err));
+    }
+    return promise.publish();
+  }
+
+  /// Runs once the awaited AsyncEitherImpl is finished: resumes with its
+  /// data, or propagates its error.
+  static auto _continue(AsyncContinuation& self) noexcept
+      -> std::coroutine_handle<>
+  {
+    auto& awaiter = static_cast<PropagatingAwaiter&>(self);
+    if (awaiter._awaitableEither.data())
+      return self.awaiting;
+    return awaiter._propagate();
+  }
+
+public:
+  explicit PropagatingAwaiter(SOURCE&& awaitableEither, Promise& promise)
+      noexcept
+    requires(!IS_LVALUE)
+      : _awaitableEither{std::move(awaitableEither)}, _promise{promise}
+  {
+  }
+
+  explicit PropagatingAwaiter(SOURCE& awaitableEither, Promise& promise)
+      noexcept
+    requires(IS_LVALUE)
+      : _awaitableEither{awaitableEither}, _promise{promise}
+  {
+  }
+
+  // NOLINTBEGIN(readability-identifier-naming)
+  /// @brief Returns true if data exists (no suspension needed).
+  [[nodiscard]]
+  auto await_ready() noexcept -> bool
+  {
+    return static_cast<bool>(_awaitableEither.data());
+  }
+
+  /// @brief Stores the error as this coroutine's result, then resumes the
+  /// coroutine waiting for it, if any.
+  auto await_suspend(std::coroutine_handle<> /*unused*/) noexcept(
+      std::is_nothrow_move_assignable_v<ERROR>) -> std::coroutine_handle<>
+    requires(!is_async_either_v<SOURCE>)
+  {
+    return _propagate();
+  }
+
+  /// @brief Waits for a pending AsyncEitherImpl, then resumes with its data
+  /// or propagates its error.
+  auto await_suspend(std::coroutine_handle<> h) noexcept
+      -> std::coroutine_handle<>
+    requires(is_async_either_v<SOURCE>)
+  {
+    this->awaiting = h;
+    this->resume = &_continue;
+    if (_awaitableEither._park(*this))
+      return std::noop_coroutine();
+    return _continue(*this);
+  }
+
+  /// @brief No-op for Void data type.
+  void await_resume() noexcept
+    requires(std::is_same_v<OTHER, Void>)
+  {
+  }
+
+  /// @brief Moves the data value out of the awaited temporary (rvalue).
+  [[nodiscard]]
+  auto await_resume() noexcept(std::is_nothrow_move_assignable_v<OTHER>)
+      -> OTHER
+    requires(!std::is_same_v<OTHER, Void> && !IS_LVALUE)
+  {
+    return std::move(_awaitableEither).takeData();
+  }
+
+  /// @brief Returns reference to data value (lvalue).
+  [[nodiscard]]
+  auto await_resume() noexcept -> OTHER&
+    requires(!std::is_same_v<OTHER, Void> && IS_LVALUE)
+  {
+    auto d = _awaitableEither.data();
+    assert(d && "AsyncEitherImpl must contain data");
+
+    return *d;
+  }
+  // NOLINTEND(readability-identifier-naming)
+};
+} // namespace ropic::detail
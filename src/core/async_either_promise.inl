@@ -0,0 +1,309 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <tuple>
+#include <utility>
+
+#include "async_continuation.hpp"
+#include "async_either.hpp"
+#include "either_storage.hpp"
+#include "frame_promise.hpp"
+#include "in_place.hpp"
+#include "value_either.hpp"
+
+namespace ropic::detail
+{
+/**
+ * @brief Promise type for AsyncEither coroutines.
+ *
+ * Controls coroutine lifecycle: immediate start, final suspend, and stores
+ * co_return values into its own result slot, which the AsyncEitherImpl reads
+ * through its handle.
+ */
+template <typename DATA, typename ERROR>
+class AsyncEitherImpl<DATA, ERROR>::Promise
+    : public FramePromise<AsyncEitherImpl>
+{
+  /// Holds a null handle while the coroutine runs, then data or error.
+  using Pending = std::coroutine_handle<>;
+
+  EitherStorageFor<Pending, DATA, Stored> _result{std::in_place_type<Pending>};
+
+  /// Null while the coroutine runs, the AsyncContinuation of a coroutine
+  /// waiting for it, then this promise once the result is published. Set with
+  /// release semantics once the coroutine holding the result has suspended
+  /// for good; the frame may be destroyed as soon as it is seen.
+  std::atomic<void*> _state = nullptr;
+
+  template <typename T, typename... ARGS>
+  void _finish(ARGS&&... args)
+      noexcept(std::is_nothrow_constructible_v<T, ARGS&&...>)
+  {
+    _result.template emplace<T>(std::forward<ARGS>(args)...);
+  }
+
+  /// Suspends at the end of the coroutine, publishes its result and
+  /// resumes the coroutine waiting for it, if any.
+  struct FinalAwaiter
+  {
+    // NOLINTBEGIN(readability-identifier-naming)
+    [[nodiscard]]
+    auto await_ready() const noexcept -> bool
+    {
+      return false;
+    }
+
+    auto await_suspend(Handle h) const noexcept -> std::coroutine_handle<>
+    {
+      return h.promise().publish();
+    }
+
+    void await_resume() const noexcept {}
+    // NOLINTEND(readability-identifier-naming)
+  };
+
+public:
+  using DataType = DATA;
+
+  /// @brief Returns true once the result is set; acquires it.
+  [[nodiscard]]
+  auto done() const noexcept -> bool
+  {
+    return _state.load(std::memory_order_acquire) == this;
+  }
+
+  /// @brief Registers `continuation` to run once the result is published.
+  /// @return false if it already is; the result is then acquired.
+  [[nodiscard]]
+  auto park(AsyncContinuation& continuation) noexcept -> bool
+  {
+    void* expected = nullptr;
+    const bool parked = _state.compare_exchange_strong(
+        expected,
+        &continuation,
+        std::memory_order_acq_rel,
+        std::memory_order_acquire);
+    assert(
+        (parked || expected == this)
+        && "AsyncEither can only be awaited by one coroutine at a time");
+    return parked;
+  }
+
+  /// @brief Marks the result as set; releases it to done() callers and runs
+  /// the continuation of the coroutine waiting for it, if any.
+  /// @pre The coroutine is suspended for good, and nothing of its frame is
+  /// touched afterwards: a poller may destroy it right away.
+  /// @return The coroutine to resume next.
+  [[nodiscard]]
+  auto publish() noexcept -> std::coroutine_handle<>
+  {
+    void* waiting = _state.exchange(this, std::memory_order_acq_rel);
+    if (!waiting)
+      return std::noop_coroutine();
+
+    auto& continuation = *static_cast<AsyncContinuation*>(waiting);
+    return continuation.resume(continuation);
+  }
+
+  /// @brief Returns the result alternative `T`, or nullptr.
+  /// @pre done() returned true.
+  template <typename T>
+  [[nodiscard]]
+  auto result() noexcept -> T*
+  {
+    return _result.template getIf<T>();
+  }
+
+  /// @brief Constructs the error in place from `args`; publish() makes it
+  /// visible.
+  template <typename... ARGS>
+  void setError(ARGS&&... args) noexcept(
+      std::is_nothrow_constructible_v<ERROR, ARGS&&...> && !box_error_v<ERROR>)
+  {
+    if constexpr (box_error_v<ERROR>)
+      _finish<Stored>(std::in_place, std::forward<ARGS>(args)...);
+    else
+      _finish<ERROR>(std::forward<ARGS>(args)...);
+  }
+
+  /// @brief Takes over a stored error (or its box) as is; publish() makes
+  /// it visible.
+  void takeError(Stored& stored)
+      noexcept(std::is_nothrow_move_constructible_v<Stored>)
+  {
+    _finish<Stored>(std::move(stored));
+  }
+
+  // NOLINTBEGIN(readability-identifier-naming)
+  /// @brief Creates the AsyncEitherImpl owning this promise's frame.
+  [[nodiscard]]
+  auto get_return_object() noexcept -> AsyncEitherImpl
+  {
+    return AsyncEitherImpl{Handle::from_promise(*this)};
+  }
+
+  /// @brief Starts execution immediately (no initial suspend).
+  [[nodiscard]]
+  auto initial_suspend() noexcept -> std::suspend_never
+  {
+    return {};
+  }
+
+  /// @brief Handles co_return with a DATA value, moved into the result.
+  void return_value(DATA&& value)
+      noexcept(std::is_nothrow_move_constructible_v<DATA>)
+  {
+    _finish<DATA>(std::move(value));
+  }
+
+  /// @brief Handles co_return with a DATA value, copied into the result.
+  void return_value(const DATA& value)
+      noexcept(std::is_nothrow_copy_constructible_v<DATA>)
+  {
+    _finish<DATA>(value);
+  }
+
+  /// @brief Handles co_return with an ERROR value, moved into the result.
+  void return_value(ERROR&& value)
+      noexcept(noexcept(std::declval<Promise&>().setError(
+          std::declval<ERROR&&>())))
+  {
+    setError(std::move(value));
+  }
+
+  /// @brief Handles co_return with an ERROR value, copied into the result.
+  void return_value(const ERROR& value)
+      noexcept(noexcept(std::declval<Promise&>().setError(
+          std::declval<const ERROR&>())))
+  {
+    setError(value);
+  }
+
+  /// @brief Handles `co_return ropic::in_place(args...)`: constructs DATA
+  /// directly in the result.
+  template <typename... ARGS>
+  void return_value(InPlaceData<ARGS...> place)
+      noexcept(std::is_nothrow_constructible_v<DATA, ARGS&&...>)
+  {
+    std::apply(
+        [this](ARGS&&... args) { _finish<DATA>(std::forward<ARGS>(args)...); },
+        std::move(place.args));
+  }
+
+  /// @brief Handles `co_return ropic::in_place_error(args...)`: constructs
+  /// ERROR directly in the result.
+  template <typename... ARGS>
+  void return_value(InPlaceError<ARGS...> place) noexcept(noexcept(
+      std::declval<Promise&>().setError(std::declval<ARGS&&>()...)))
+  {
+    std::apply(
+        [this](ARGS&&... args) { setError(std::forward<ARGS>(args)...); },
+        std::move(place.args));
+  }
+
+  /// @brief Suspends at coroutine end, then publishes the result held by
+  /// the frame and resumes the coroutine waiting for it.
+  [[nodiscard]]
+  auto final_suspend() noexcept -> FinalAwaiter
+  {
+    return {};
+  }
+
+  /// @brief Terminates on unhandled exceptions.
+  void unhandled_exception() noexcept { std::terminate(); }
+
+  /// @brief Pass-through for non-Either awaitables.
+  template <typename T>
+  auto await_transform(T&& awaitable) -> T&&
+  {
+    return static_cast<T&&>(awaitable);
+  }
+
+  /// @brief Transforms rvalue EitherImpl to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(EitherImpl<OTHER, ERROR>&& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, false, EitherImpl<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, false, EitherImpl<OTHER, ERROR>>{
+        std::move(awaitable), *this};
+  }
+
+  /// @brief Transforms lvalue EitherImpl to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(EitherImpl<OTHER, ERROR>& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, true, EitherImpl<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, true, EitherImpl<OTHER, ERROR>>{
+        awaitable, *this};
+  }
+
+  /// @brief Transforms rvalue ValueEither to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(ValueEither<OTHER, ERROR>&& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, false, ValueEither<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, false, ValueEither<OTHER, ERROR>>{
+        std::move(awaitable), *this};
+  }
+
+  /// @brief Transforms lvalue ValueEither to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(ValueEither<OTHER, ERROR>& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, true, ValueEither<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, true, ValueEither<OTHER, ERROR>>{
+        awaitable, *this};
+  }
+
+  /// @brief Transforms rvalue AsyncEitherImpl to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(AsyncEitherImpl<OTHER, ERROR>&& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, false, AsyncEitherImpl<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, false, AsyncEitherImpl<OTHER, ERROR>>{
+        std::move(awaitable), *this};
+  }
+
+  /// @brief Transforms lvalue AsyncEitherImpl to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(AsyncEitherImpl<OTHER, ERROR>& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, true, AsyncEitherImpl<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, true, AsyncEitherImpl<OTHER, ERROR>>{
+        awaitable, *this};
+  }
+
+  /// @brief Transforms rvalue SyncEitherImpl to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(SyncEitherImpl<OTHER, ERROR>&& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, false, SyncEitherImpl<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, false, SyncEitherImpl<OTHER, ERROR>>{
+        std::move(awaitable), *this};
+  }
+
+  /// @brief Transforms lvalue SyncEitherImpl to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(SyncEitherImpl<OTHER, ERROR>& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, true, SyncEitherImpl<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, true, SyncEitherImpl<OTHER, ERROR>>{
+        awaitable, *this};
+  }
+  // NOLINTEND(readability-identifier-naming)
+};
+} // namespace ropic::detail
@@ -34,7 +34,7 @@ class Borrower
 
 public:
   /// @brief Constructs a Borrower from a raw pointer (may be nullptr).
-  explicit Borrower(T* pointer) noexcept : _pointer(pointer) {}
+  constexpr explicit Borrower(T* pointer) noexcept : _pointer(pointer) {}
 
   Borrower(Borrower const&) = delete;
   Borrower(Borrower&&) = delete;
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "async_continuation.hpp"
 #include "either_impl.hpp"
 #include "void.hpp"
 
@@ -13,21 +14,62 @@ namespace ropic::detail
  * @brief Awaiter for Either-to-Either composition with automatic error
  * propagation.
  *
- * Used when co_await-ing an EitherImpl<OTHER, ERROR> inside an EitherImpl<DATA,
- * ERROR> coroutine. On error: propagates to caller and destroys the coroutine.
- * On success: extracts and returns the data value.
+ * Used when co_await-ing an EitherImpl<OTHER, ERROR> (or another SOURCE:
+ * ValueEither<OTHER, ERROR>, SyncEitherImpl<OTHER, ERROR> or
+ * AsyncEitherImpl<OTHER, ERROR>) inside an EitherImpl<DATA, ERROR> coroutine.
+ * On error: propagates to caller and destroys the coroutine. On success:
+ * extracts and returns the data value. A pending AsyncEitherImpl is waited
+ * for: the coroutine suspends until its result is published.
  */
 template <typename DATA, typename ERROR>
-template <typename OTHER, bool IS_LVALUE>
+template <typename OTHER, bool IS_LVALUE, typename SOURCE>
 class EitherImpl<DATA, ERROR>::PropagatingAwaiter
+    : ContinuationFor<SOURCE>
 {
-  AwaitableEither<OTHER, IS_LVALUE> _awaitableEither;
+  std::conditional_t<IS_LVALUE, SOURCE&, SOURCE&&> _awaitableEither;
   EitherImpl& _returnEither;
 
+  /// Errors of another awaited EitherImpl, SyncEitherImpl or AsyncEitherImpl
+  /// temporary are handed over in their stored form, so boxed errors move
+  /// without a new allocation. An lvalue keeps its box, holding the
+  /// moved-from error, so that it still holds an error afterwards.
+  void _propagate(EitherImpl& returnEither, Handle h)
+      noexcept(std::is_nothrow_move_assignable_v<ERROR>)
+  {
+    if constexpr (
+        !IS_LVALUE && !std::is_same_v<SOURCE, ValueEither<OTHER, ERROR>>)
+    {
+      returnEither._takeErrorAndNullifyHandle(_awaitableEither);
+    }
+    else
+    {
+      auto err = _awaitableEither.error();
+      assert(err && "`await_suspend` must be called with error state");
+
+      returnEither._setErrorAndNullifyHandle(std::move(*err));
+    }
+    h.destroy();
+  }
+
+  /// Runs once the awaited AsyncEitherImpl is finished: resumes with its
+  /// data, or propagates its error. The pending EitherImpl may have moved
+  /// while waiting, so its address is taken from the promise.
+  static auto _continue(AsyncContinuation& self) noexcept
+      -> std::coroutine_handle<>
+  {
+    auto& awaiter = static_cast<PropagatingAwaiter&>(self);
+    if (awaiter._awaitableEither.data())
+      return self.awaiting;
+
+    auto h = Handle::from_address(self.awaiting.address());
+    awaiter._propagate(h.promise().either(), h);
+    return std::noop_coroutine();
+  }
+
 public:
   explicit PropagatingAwaiter(
-      EitherImpl<OTHER, ERROR>&& awaitableEither, EitherImpl& returnEither)
-      noexcept(std::is_nothrow_move_assignable_v<EitherImpl<OTHER, ERROR>>)
+      SOURCE&& awaitableEither, EitherImpl& returnEither)
+      noexcept(std::is_nothrow_move_assignable_v<SOURCE>)
     requires(!IS_LVALUE)
       : _awaitableEither{std::move(awaitableEither)},
         _returnEither{returnEither}
@@ -35,8 +77,7 @@ public:
   }
 
   explicit PropagatingAwaiter(
-      EitherImpl<OTHER, ERROR>& awaitableEither,
-      EitherImpl& returnEither) noexcept
+      SOURCE& awaitableEither, EitherImpl& returnEither) noexcept
     requires(IS_LVALUE)
       : _awaitableEither{awaitableEither}, _returnEither{returnEither}
   {
@@ -53,12 +94,22 @@ public:
   /// @brief Propagates error to caller and destroys the coroutine.
   void await_suspend(std::coroutine_handle<Promise> h)
       noexcept(std::is_nothrow_move_assignable_v<ERROR>)
+    requires(!is_async_either_v<SOURCE>)
   {
-    auto err = _awaitableEither.error();
-    assert(err && "`await_suspend` must be called with error state");
+    _propagate(_returnEither, h);
+  }
 
-    _returnEither._setErrorAndNullifyHandle(std::move(*err));
-    h.destroy();
+  /// @brief Waits for a pending AsyncEitherImpl, then resumes with its data
+  /// or propagates its error.
+  auto await_suspend(std::coroutine_handle<Promise> h) noexcept
+      -> std::coroutine_handle<>
+    requires(is_async_either_v<SOURCE>)
+  {
+    this->awaiting = h;
+    this->resume = &_continue;
+    if (_awaitableEither._park(*this))
+      return std::noop_coroutine();
+    return _continue(*this);
   }
 
   /// @brief No-op for Void data type.
@@ -67,16 +118,13 @@ public:
   {
   }
 
-  /// @brief Extracts and moves data value (rvalue).
+  /// @brief Moves the data value out of the awaited temporary (rvalue).
   [[nodiscard]]
   auto await_resume() noexcept(std::is_nothrow_move_assignable_v<OTHER>)
       -> OTHER
     requires(!std::is_same_v<OTHER, Void> && !IS_LVALUE)
   {
-    auto d = _awaitableEither.data();
-    assert(d && "EitherImpl must contain data");
-
-    return std::move(*d);
+    return std::move(_awaitableEither).takeData();
   }
 
   /// @brief Returns reference to data value (lvalue).
@@ -0,0 +1,334 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "borrower.hpp"
+#include "either_concept.hpp"
+#include "either_impl.hpp"
+#include "value_either.hpp"
+
+namespace ropic
+{
+/**
+ * @brief Column of results stored as a structure of arrays.
+ *
+ * A `std::vector<Either<DATA, ERROR>>` interleaves every DATA with room for
+ * an ERROR and a tag. EitherColumn keeps:
+ * - one DATA slot per row, contiguous; rows holding an error keep a
+ *   value-initialized DATA there;
+ * - a bitmap telling which rows hold data;
+ * - the errors in a side table sorted by row, sized by the number of errors.
+ *
+ * Aggregates over the data are plain loops over values(). Since error rows
+ * hold zero for arithmetic types, summing values() sums the successful rows:
+ *
+ * @code
+ * ropic::EitherColumn<double, Error> column;
+ * for (const auto& [num, den] : inputs)
+ *     column.push_back(divideStr(num, den));
+ * auto values = column.values();
+ * double sum = std::reduce(values.begin(), values.end());
+ * @endcode
+ *
+ * @tparam DATA Default-constructible success value type.
+ * @tparam ERROR The error type.
+ */
+template <typename DATA, typename ERROR>
+class EitherColumn
+{
+  static_assert(
+      detail::either_concept<DATA, ERROR>,
+      "`DATA` and `ERROR` must not be identical and not be reference, const, "
+      "void or monostate types");
+  static_assert(
+      std::is_default_constructible_v<DATA>,
+      "EitherColumn fills error rows with a value-initialized `DATA`");
+
+  using Word = std::uint64_t;
+
+  static constexpr std::size_t WORD_BITS = 64;
+
+public:
+  /// @brief An error and the row holding it.
+  struct IndexedError
+  {
+    std::size_t index;
+    ERROR error;
+  };
+
+  class Iterator;
+
+  /// @brief Read-only view of one row.
+  class Row
+  {
+    const DATA* _data;
+    const ERROR* _error;
+
+    friend class Iterator;
+    friend class EitherColumn;
+
+    Row(const DATA* data, const ERROR* error) noexcept
+        : _data(data), _error(error)
+    {
+    }
+
+  public:
+    /// @brief Returns the data of the row, or an empty Borrower.
+    [[nodiscard]]
+    auto data() const noexcept -> Borrower<const DATA>
+    {
+      return Borrower<const DATA>{_data};
+    }
+
+    /// @brief Returns the error of the row, or an empty Borrower.
+    [[nodiscard]]
+    auto error() const noexcept -> Borrower<const ERROR>
+    {
+      return Borrower<const ERROR>{_error};
+    }
+  };
+
+  /// @brief Forward iterator over the rows, walking the error table along.
+  class Iterator
+  {
+    const EitherColumn* _column = nullptr;
+    std::size_t _index = 0;
+    /// Position in the error table of the first error at or after `_index`.
+    std::size_t _nextError = 0;
+
+    friend class EitherColumn;
+
+    Iterator(
+        const EitherColumn* column,
+        std::size_t index,
+        std::size_t nextError) noexcept
+        : _column(column), _index(index), _nextError(nextError)
+    {
+    }
+
+  public:
+    // NOLINTBEGIN(readability-identifier-naming)
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Row;
+    using difference_type = std::ptrdiff_t;
+    // NOLINTEND(readability-identifier-naming)
+
+    Iterator() noexcept = default;
+
+    [[nodiscard]]
+    auto operator*() const noexcept -> Row
+    {
+      if (_column->holdsData(_index))
+        return Row{&_column->_data[_index], nullptr};
+      return Row{nullptr, &_column->_errors[_nextError].error};
+    }
+
+    auto operator++() noexcept -> Iterator&
+    {
+      if (!_column->holdsData(_index))
+        ++_nextError;
+      ++_index;
+      return *this;
+    }
+
+    auto operator++(int) noexcept -> Iterator
+    {
+      Iterator previous = *this;
+      ++*this;
+      return previous;
+    }
+
+    [[nodiscard]]
+    auto operator==(const Iterator& other) const noexcept -> bool
+    {
+      return _index == other._index;
+    }
+  };
+
+private:
+  std::vector<DATA> _data;
+  std::vector<Word> _valid;
+  std::vector<IndexedError> _errors;
+
+  /// @brief Grows the bitmap to cover one more row; idempotent.
+  void _reserveBit()
+  {
+    _valid.resize(size() / WORD_BITS + 1);
+  }
+
+  void _setBit(std::size_t index) noexcept
+  {
+    _valid[index / WORD_BITS] |= Word{1} << (index % WORD_BITS);
+  }
+
+  /// @brief Returns the error table entry of row `index`.
+  [[nodiscard]]
+  auto _findError(std::size_t index) const noexcept -> const IndexedError*
+  {
+    const auto it = std::lower_bound(
+        _errors.begin(),
+        _errors.end(),
+        index,
+        [](const IndexedError& entry, std::size_t row)
+        { return entry.index < row; });
+    return it != _errors.end() && it->index == index ? &*it : nullptr;
+  }
+
+public:
+  /// @brief Reserves room for `rows` rows and `errors` errors.
+  void reserve(std::size_t rows, std::size_t errors = 0)
+  {
+    _data.reserve(rows);
+    _valid.reserve((rows + WORD_BITS - 1) / WORD_BITS);
+    _errors.reserve(errors);
+  }
+
+  /// @brief Appends a row holding `data`.
+  void pushData(DATA data)
+  {
+    _reserveBit();
+    _data.push_back(std::move(data));
+    _setBit(size() - 1);
+  }
+
+  /// @brief Appends a row holding `error`.
+  void pushError(ERROR error)
+  {
+    _reserveBit();
+    _errors.push_back(IndexedError{size(), std::move(error)});
+    try
+    {
+      _data.emplace_back();
+    }
+    catch (...)
+    {
+      _errors.pop_back();
+      throw;
+    }
+  }
+
+  // NOLINTBEGIN(readability-identifier-naming)
+  /// @brief Appends the result of `either`, moving it out.
+  /// @pre `either.done()`.
+  void push_back(detail::EitherImpl<DATA, ERROR>&& either)
+  {
+    assert(either.done() && "Only finished Eithers can be stored");
+    if (either.data())
+      pushData(std::move(either).takeData());
+    else
+      pushError(std::move(either).takeError());
+  }
+
+  /// @brief Appends the result of a ValueEither; a template so that the
+  /// ValueEither type is only instantiated when used.
+  template <typename VALUE_EITHER>
+    requires std::is_same_v<VALUE_EITHER, ValueEither<DATA, ERROR>>
+  void push_back(const VALUE_EITHER& either)
+  {
+    if (auto data = either.data())
+      pushData(*data);
+    else
+      pushError(*either.error());
+  }
+  // NOLINTEND(readability-identifier-naming)
+
+  /// @brief Removes all rows and keeps the buffers.
+  void clear() noexcept
+  {
+    _data.clear();
+    _valid.clear();
+    _errors.clear();
+  }
+
+  /// @brief Returns the number of rows.
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t
+  {
+    return _data.size();
+  }
+
+  [[nodiscard]]
+  auto empty() const noexcept -> bool
+  {
+    return _data.empty();
+  }
+
+  /// @brief Returns the number of rows holding an error.
+  [[nodiscard]]
+  auto errorCount() const noexcept -> std::size_t
+  {
+    return _errors.size();
+  }
+
+  /// @brief Returns true if row `index` holds data.
+  [[nodiscard]]
+  auto holdsData(std::size_t index) const noexcept -> bool
+  {
+    assert(index < size() && "EitherColumn index out of range");
+    return ((_valid[index / WORD_BITS] >> (index % WORD_BITS)) & 1U) != 0;
+  }
+
+  /// @brief Returns row `index`; finding an error takes a binary search.
+  [[nodiscard]]
+  auto operator[](std::size_t index) const noexcept -> Row
+  {
+    if (holdsData(index))
+      return Row{&_data[index], nullptr};
+    return Row{nullptr, &_findError(index)->error};
+  }
+
+  /// @brief Returns one DATA per row, value-initialized for error rows.
+  [[nodiscard]]
+  auto values() const noexcept -> std::span<const DATA>
+  {
+    return _data;
+  }
+
+  /// @brief Returns the validity bitmap, 64 rows per word, bit set for data.
+  [[nodiscard]]
+  auto validity() const noexcept -> std::span<const Word>
+  {
+    return _valid;
+  }
+
+  /// @brief Returns the errors with their rows, in row order.
+  [[nodiscard]]
+  auto errors() const noexcept -> std::span<const IndexedError>
+  {
+    return _errors;
+  }
+
+  [[nodiscard]]
+  auto begin() const noexcept -> Iterator
+  {
+    return Iterator{this, 0, 0};
+  }
+
+  [[nodiscard]]
+  auto end() const noexcept -> Iterator
+  {
+    return Iterator{this, size(), _errors.size()};
+  }
+
+  /// @brief Copies row `index` back into an Either.
+  [[nodiscard]]
+  auto either(std::size_t index) const -> detail::EitherImpl<DATA, ERROR>
+  {
+    if (holdsData(index))
+      return detail::EitherImpl<DATA, ERROR>{_data[index]};
+    return detail::EitherImpl<DATA, ERROR>{_findError(index)->error};
+  }
+};
+} // namespace ropic
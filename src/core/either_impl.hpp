@@ -5,14 +5,64 @@
 
 #include <cassert>
 #include <coroutine>
-#include <variant>
+#include <functional>
+#include <type_traits>
+#include <utility>
 
 #include "attributes.hpp"
 #include "borrower.hpp"
 #include "either_concept.hpp"
+#include "error_box.hpp"
+#include "in_place.hpp"
+#include "either_storage.hpp"
+#include "relocation.hpp"
+#include "value_either.hpp"
+#include "void.hpp"
 
 namespace ropic::detail
 {
+template <typename DATA, typename ERROR>
+class AsyncEitherImpl;
+
+template <typename DATA, typename ERROR>
+class EitherImpl;
+
+template <typename DATA, typename ERROR>
+class SyncEitherImpl;
+
+template <typename... STEPS>
+class Pipeline;
+
+template <typename SOURCE>
+class PropagatedError;
+
+/// @brief Tells whether `T` is an EitherImpl, and with which payloads.
+template <typename T>
+struct EitherTraits
+{
+  static constexpr bool IS_EITHER = false;
+};
+
+template <typename DATA, typename ERROR>
+struct EitherTraits<EitherImpl<DATA, ERROR>>
+{
+  static constexpr bool IS_EITHER = true;
+  using Data = DATA;
+  using Error = ERROR;
+};
+
+/// @brief Result of calling `F` on the data of an EitherImpl; Unit data is
+/// not passed, so void-like Eithers take nullary callables.
+template <typename F, typename DATA>
+using DataInvokeResult = std::remove_cvref_t<typename std::conditional_t<
+    std::is_same_v<DATA, Unit>,
+    std::invoke_result<F>,
+    std::invoke_result<F, DATA&&>>::type>;
+
+/// @brief Data type of an EitherImpl holding a `T`; void maps to Unit.
+template <typename T>
+using DataOf = std::conditional_t<std::is_void_v<T>, Unit, T>;
+
 /**
  * @class EitherImpl
  * @brief Coroutine-based Railway Oriented Programming type: holds either data,
@@ -26,6 +76,10 @@ namespace ropic::detail
  * - **Value Mode**: Direct container for error/data.
  * - **Coroutine Mode**: Return type for coroutines; values stored in promise.
  *
+ * Value mode, combinators included, is usable in constant expressions unless
+ * DATA or ERROR opts in to single-word storage (see NicheEitherStorage) or
+ * ERROR is boxed.
+ *
  * @warning The `data()` and `error()` methods return Borrower pointers that
  * become dangling after the EitherImpl object is destroyed or moved.
  */
@@ -46,13 +100,36 @@ class ROPIC_CORO_AWAIT_ELIDABLE EitherImpl
   template <bool IS_LVALUE>
   class InteropAwaiter;
 
-  /// Awaiter for EitherImpl-to-EitherImpl composition. Propagates errors,
-  /// extracts values.
-  template <typename OTHER, bool IS_LVALUE>
+  /// Awaiter for EitherImpl-to-EitherImpl (or ValueEither) composition.
+  /// Propagates errors, extracts values.
+  template <
+      typename OTHER,
+      bool IS_LVALUE,
+      typename SOURCE = EitherImpl<OTHER, ERROR>>
   class PropagatingAwaiter;
 
   using Handle = std::coroutine_handle<Promise>;
 
+  /// ERROR itself, or its ErrorBox when ropic::box_error opts it in.
+  using Stored = StoredError<ERROR>;
+
+  template <typename OTHER_DATA, typename OTHER_ERROR>
+  friend class EitherImpl;
+
+  template <typename OTHER_DATA, typename OTHER_ERROR>
+  friend class AsyncEitherImpl;
+
+  template <typename OTHER_DATA, typename OTHER_ERROR>
+  friend class SyncEitherImpl;
+
+  template <typename... STEPS>
+  friend class Pipeline;
+
+  template <typename SOURCE>
+  friend class PropagatedError;
+
+  friend struct RebindAfterRelocation<EitherImpl>;
+
   template <typename OTHER, bool IS_LVALUE>
   using AwaitableEither = std::conditional_t<
       IS_LVALUE,
@@ -62,30 +139,94 @@ class ROPIC_CORO_AWAIT_ELIDABLE EitherImpl
   // ==========================================
   // PRIVATE VARIABLES & FUNCTIONS
   // ==========================================
-  /// Coroutine handle (null in value mode)
-  Handle _handle;
-
-  /// Holds empty, data, or error
-  std::variant<std::monostate, DATA, ERROR> _result;
+  /// Holds the coroutine handle while empty, then data or error. The handle
+  /// and the result are never needed at the same time, so they share
+  /// storage; a null handle is the empty state (value mode, moved-from).
+  /// Payloads opted in through niche_traits or pack_inline fold the whole
+  /// state into one word.
+  EitherStorageFor<Handle, DATA, Stored> _result;
 
   /// @brief Constructs an EitherImpl from a coroutine handle (coroutine mode).
-  explicit EitherImpl(Handle h) noexcept : _handle(h), _result(std::monostate{})
+  explicit EitherImpl(Handle h) noexcept
+      : _result(std::in_place_type<Handle>, h)
+  {
+    h.promise().setEither(this);
+  }
+
+  /// @brief Constructs the `T` alternative from `args` (value mode); lets
+  /// combinators hand a stored error over without reboxing it.
+  template <typename T, typename... ARGS>
+  constexpr explicit EitherImpl(std::in_place_type_t<T> type, ARGS&&... args)
+      : _result(type, std::forward<ARGS>(args)...)
   {
-    _handle.promise().setEither(this);
   }
 
-  void _setErrorAndNullifyHandle(ERROR&& value)
-      noexcept(std::is_nothrow_move_assignable_v<ERROR>)
+  /// @brief Calls `f` on the moved data, or with no argument for Unit data.
+  template <typename F>
+  constexpr auto _invokeOnData(F&& f) -> decltype(auto)
   {
-    _result = std::move(value);
-    _handle = nullptr;
+    if constexpr (std::is_same_v<DATA, Unit>)
+      return std::invoke(std::forward<F>(f));
+    else
+      return std::invoke(
+          std::forward<F>(f), std::move(*_result.template getIf<DATA>()));
   }
 
-  void _setDataAndNullifyHandle(DATA&& value)
-      noexcept(std::is_nothrow_move_assignable_v<DATA>)
+  /// @brief Points the promise of a pending coroutine back at `this`.
+  constexpr void _rebind() noexcept
   {
-    _result = std::move(value);
-    _handle = nullptr;
+    if (Handle handle = _handle())
+      handle.promise().setEither(this);
+  }
+
+  /// @brief Returns the coroutine handle, or null once a result is set.
+  [[nodiscard]]
+  constexpr auto _handle() const noexcept -> Handle
+  {
+    return _result.handle();
+  }
+
+  /// @brief Constructs the error in place from `args`.
+  template <typename... ARGS>
+  constexpr void _setErrorAndNullifyHandle(ARGS&&... args) noexcept(
+      std::is_nothrow_constructible_v<ERROR, ARGS&&...> && !box_error_v<ERROR>)
+  {
+    if constexpr (box_error_v<ERROR>)
+    {
+      _result.template emplace<Stored>(
+          std::in_place, std::forward<ARGS>(args)...);
+    }
+    else
+    {
+      _result.template emplace<ERROR>(std::forward<ARGS>(args)...);
+    }
+  }
+
+  /// @brief Returns the stored error (or its box), or nullptr.
+  [[nodiscard]]
+  constexpr auto _storedError() noexcept -> Stored*
+  {
+    return _result.template getIf<Stored>();
+  }
+
+  /// @brief Takes over the stored error (or its box) of `other` as is.
+  /// @tparam SOURCE An EitherImpl, AsyncEitherImpl or SyncEitherImpl with the
+  /// same ERROR.
+  template <typename SOURCE>
+  constexpr void _takeErrorAndNullifyHandle(SOURCE& other) noexcept(
+      std::is_nothrow_move_constructible_v<Stored>)
+  {
+    Stored* stored = other._storedError();
+    assert(stored && "`other` must hold an error");
+    _result.template emplace<Stored>(std::move(*stored));
+  }
+
+  /// @brief Constructs the data in place from `args`.
+  template <typename... ARGS>
+  constexpr void _setDataAndNullifyHandle(ARGS&&... args)
+      noexcept(std::is_nothrow_constructible_v<DATA, ARGS&&...>)
+  {
+    _result.template emplace<DATA>(std::forward<ARGS>(args)...);
   }
 
 public:
@@ -96,14 +237,16 @@ public:
   // ==========================================
 
   /// @brief Constructs an EitherImpl containing an error.
-  EitherImpl(ERROR e) noexcept(std::is_nothrow_move_constructible_v<ERROR>)
-      : _handle(nullptr), _result(std::move(e))
+  constexpr EitherImpl(ERROR e)
+      noexcept(std::is_nothrow_constructible_v<Stored, ERROR&&>)
+      : _result(std::in_place_type<Stored>, std::move(e))
   {
   }
 
   /// @brief Constructs an EitherImpl containing data.
-  EitherImpl(DATA d) noexcept(std::is_nothrow_move_constructible_v<DATA>)
-      : _handle(nullptr), _result(std::move(d))
+  constexpr EitherImpl(DATA d)
+      noexcept(std::is_nothrow_move_constructible_v<DATA>)
+      : _result(std::in_place_type<DATA>, std::move(d))
   {
   }
 
@@ -114,47 +257,39 @@ public:
   auto operator=(const EitherImpl&) -> EitherImpl& = delete;
 
   /// @brief Destroy handle if not null
-  ~EitherImpl() noexcept
+  constexpr ~EitherImpl() noexcept
   {
-    if (_handle)
-      _handle.destroy();
+    if (Handle handle = _handle())
+      handle.destroy();
   }
 
   /// @brief Move constructor; transfers ownership of handle and result.
   /// Updates the promise's Either pointer if coroutine is still active.
-  EitherImpl(EitherImpl&& other) noexcept(
+  constexpr EitherImpl(EitherImpl&& other) noexcept(
       std::is_nothrow_move_constructible_v<DATA>
-      && std::is_nothrow_move_constructible_v<ERROR>)
-      : _handle(other._handle), _result(std::move(other._result))
+      && std::is_nothrow_move_constructible_v<Stored>)
+      : _result(std::move(other._result))
   {
     // Update promise to point to new location (critical for async coroutines)
-    if (_handle)
-      _handle.promise().setEither(this);
-
-    other._handle = nullptr;
-    other._result = std::monostate{};
+    _rebind();
+    other._result.template emplace<Handle>();
   }
 
   /// @brief Move assignment operator.
   /// Updates the promise's Either pointer if coroutine is still active.
-  auto operator=(EitherImpl&& other) noexcept(
-      std::is_nothrow_move_assignable_v<DATA>
-      && std::is_nothrow_move_assignable_v<ERROR>) -> EitherImpl&
+  constexpr auto operator=(EitherImpl&& other) noexcept(
+      std::is_nothrow_move_constructible_v<DATA>
+      && std::is_nothrow_move_constructible_v<Stored>) -> EitherImpl&
   {
     if (this != &other)
     {
-      if (_handle)
-        _handle.destroy();
-      _handle = other._handle;
+      if (Handle handle = _handle())
+        handle.destroy();
+      _result = std::move(other._result);
 
       // Update promise to point to new location (critical for async coroutines)
-      if (_handle)
-        _handle.promise().setEither(this);
-
-      other._handle = nullptr;
-
-      _result = std::move(other._result);
-      other._result = std::monostate{};
+      _rebind();
+      other._result.template emplace<Handle>();
     }
     return *this;
   }
@@ -189,16 +324,17 @@ public:
    * For coroutine mode, extracts result from promise on first access.
    */
   [[nodiscard]]
-  auto error() noexcept -> Borrower<ERROR>
+  constexpr auto error() noexcept -> Borrower<ERROR>
   {
-    return Borrower<ERROR>{std::get_if<ERROR>(&_result)};
+    return Borrower<ERROR>{unboxError<ERROR>(_result.template getIf<Stored>())};
   }
 
   /// @copydoc error()
   [[nodiscard]]
-  auto error() const noexcept -> Borrower<const ERROR>
+  constexpr auto error() const noexcept -> Borrower<const ERROR>
   {
-    return Borrower<const ERROR>{std::get_if<ERROR>(&_result)};
+    return Borrower<const ERROR>{
+        unboxError<ERROR>(_result.template getIf<Stored>())};
   }
 
   /**
@@ -211,16 +347,51 @@ public:
    * For coroutine mode, extracts result from promise on first access.
    */
   [[nodiscard]]
-  auto data() noexcept -> Borrower<DATA>
+  constexpr auto data() noexcept -> Borrower<DATA>
   {
-    return Borrower<DATA>{std::get_if<DATA>(&_result)};
+    return Borrower<DATA>{_result.template getIf<DATA>()};
   }
 
   /// @copydoc data()
   [[nodiscard]]
-  auto data() const noexcept -> Borrower<const DATA>
+  constexpr auto data() const noexcept -> Borrower<const DATA>
+  {
+    return Borrower<const DATA>{_result.template getIf<DATA>()};
+  }
+
+  /**
+   * @brief Moves the data out and leaves the EitherImpl empty.
+   *
+   * Unlike `std::move(*either.data())`, the moved-from DATA is destroyed
+   * right away instead of lingering until the EitherImpl is destroyed.
+   * @pre data() is not empty.
+   */
+  [[nodiscard]]
+  constexpr auto takeData() &&
+      noexcept(std::is_nothrow_move_constructible_v<DATA>)
+      -> DATA
   {
-    return Borrower<const DATA>{std::get_if<DATA>(&_result)};
+    DATA* data = _result.template getIf<DATA>();
+    assert(data && "EitherImpl must contain data");
+    DATA value(std::move(*data));
+    _result.template emplace<Handle>();
+    return value;
+  }
+
+  /**
+   * @brief Moves the error out and leaves the EitherImpl empty.
+   * @pre error() is not empty.
+   */
+  [[nodiscard]]
+  constexpr auto takeError() &&
+      noexcept(std::is_nothrow_move_constructible_v<ERROR>)
+      -> ERROR
+  {
+    ERROR* error = unboxError<ERROR>(_result.template getIf<Stored>());
+    assert(error && "EitherImpl must contain an error");
+    ERROR value(std::move(*error));
+    _result.template emplace<Handle>();
+    return value;
   }
 
   /**
@@ -229,9 +400,153 @@ public:
    * @return true if data or error is present, false if in empty state.
    */
   [[nodiscard]]
-  auto done() const noexcept -> bool
+  constexpr auto done() const noexcept -> bool
+  {
+    return !_result.template holds<Handle>();
+  }
+
+  // ==========================================
+  // COMBINATORS
+  // ==========================================
+  // Run on the stored result without starting a coroutine, so chaining small
+  // steps allocates no frame. They consume the EitherImpl, like takeData(),
+  // and require a result: call them on value-mode or finished Eithers.
+  // NOLINTBEGIN(readability-identifier-naming)
+
+  /**
+   * @brief Returns `f(data)` as data, or the error as is.
+   *
+   * A void `f` gives an `Either<Void, ERROR>`. For Void data, `f` takes no
+   * argument.
+   * @pre done()
+   */
+  template <typename F>
+  [[nodiscard]]
+  constexpr auto map(F&& f) &&
+      -> EitherImpl<DataOf<DataInvokeResult<F, DATA>>, ERROR>
+  {
+    using U = DataInvokeResult<F, DATA>;
+    using Mapped = EitherImpl<DataOf<U>, ERROR>;
+    assert(done() && "Combinators need a finished EitherImpl");
+    if (Stored* stored = _storedError())
+      return Mapped{std::in_place_type<Stored>, std::move(*stored)};
+    if constexpr (std::is_void_v<U>)
+    {
+      _invokeOnData(std::forward<F>(f));
+      return Mapped{std::in_place_type<Unit>, Unit::OK};
+    }
+    else
+    {
+      return Mapped{std::in_place_type<U>, _invokeOnData(std::forward<F>(f))};
+    }
+  }
+
+  /**
+   * @brief Returns `f(data)`, an EitherImpl with the same ERROR, or the error
+   * as is.
+   *
+   * `f` may itself be a coroutine; its Either is returned as it comes.
+   * @pre done()
+   */
+  template <typename F>
+  [[nodiscard]]
+  constexpr auto and_then(F&& f) && -> DataInvokeResult<F, DATA>
+  {
+    using Chained = DataInvokeResult<F, DATA>;
+    static_assert(
+        EitherTraits<Chained>::IS_EITHER, "`f` must return an Either");
+    static_assert(
+        std::is_same_v<typename EitherTraits<Chained>::Error, ERROR>,
+        "`f` must return an Either with the same `ERROR` type");
+    assert(done() && "Combinators need a finished EitherImpl");
+    if (Stored* stored = _storedError())
+      return Chained{std::in_place_type<Stored>, std::move(*stored)};
+    return _invokeOnData(std::forward<F>(f));
+  }
+
+  /**
+   * @brief Returns the data as is, or `f(error)`, an EitherImpl with the same
+   * DATA.
+   * @pre done()
+   */
+  template <typename F>
+  [[nodiscard]]
+  constexpr auto or_else(F&& f) &&
+      -> std::remove_cvref_t<std::invoke_result_t<F, ERROR&&>>
+  {
+    using Recovered = std::remove_cvref_t<std::invoke_result_t<F, ERROR&&>>;
+    static_assert(
+        EitherTraits<Recovered>::IS_EITHER, "`f` must return an Either");
+    static_assert(
+        std::is_same_v<typename EitherTraits<Recovered>::Data, DATA>,
+        "`f` must return an Either with the same `DATA` type");
+    assert(done() && "Combinators need a finished EitherImpl");
+    if (DATA* data = _result.template getIf<DATA>())
+      return Recovered{std::in_place_type<DATA>, std::move(*data)};
+    return std::invoke(
+        std::forward<F>(f), std::move(*unboxError<ERROR>(_storedError())));
+  }
+
+  /**
+   * @brief Returns the data as is, or `f(error)` as the error.
+   * @pre done()
+   */
+  template <typename F>
+  [[nodiscard]]
+  constexpr auto transform_error(F&& f) &&
+      -> EitherImpl<DATA, std::remove_cvref_t<std::invoke_result_t<F, ERROR&&>>>
+  {
+    using Mapped = EitherImpl<
+        DATA,
+        std::remove_cvref_t<std::invoke_result_t<F, ERROR&&>>>;
+    assert(done() && "Combinators need a finished EitherImpl");
+    if (DATA* data = _result.template getIf<DATA>())
+      return Mapped{std::in_place_type<DATA>, std::move(*data)};
+    Mapped mapped{std::in_place_type<typename Mapped::Handle>};
+    mapped._setErrorAndNullifyHandle(std::invoke(
+        std::forward<F>(f), std::move(*unboxError<ERROR>(_storedError()))));
+    return mapped;
+  }
+
+  /**
+   * @brief Returns the data, or `fallback` converted to DATA.
+   * @pre done()
+   */
+  template <typename U>
+  [[nodiscard]]
+  constexpr auto value_or(U&& fallback) && -> DATA
+  {
+    assert(done() && "Combinators need a finished EitherImpl");
+    if (DATA* data = _result.template getIf<DATA>())
+      return std::move(*data);
+    return static_cast<DATA>(std::forward<U>(fallback));
+  }
+
+  /// @copydoc value_or()
+  template <typename U>
+  [[nodiscard]]
+  constexpr auto value_or(U&& fallback) const& -> DATA
+  {
+    assert(done() && "Combinators need a finished EitherImpl");
+    if (const DATA* data = _result.template getIf<DATA>())
+      return *data;
+    return static_cast<DATA>(std::forward<U>(fallback));
+  }
+  // NOLINTEND(readability-identifier-naming)
+};
+
+/// Copying the bytes relocates the payload; a pending coroutine also needs
+/// its promise pointed at the new address.
+template <typename DATA, typename ERROR>
+struct RebindAfterRelocation<EitherImpl<DATA, ERROR>>
+{
+  static constexpr bool ENABLED =
+      is_trivially_relocatable_v<DATA>
+      && is_trivially_relocatable_v<StoredError<ERROR>>;
+
+  static void apply(EitherImpl<DATA, ERROR>& relocated) noexcept
   {
-    return !std::holds_alternative<std::monostate>(_result);
+    relocated._rebind();
   }
 };
 } // namespace ropic::detail
@@ -0,0 +1,350 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file either_niche.hpp
+ * @brief Pointer-sized Either storage for opted-in niche-carrying and small
+ * payloads.
+ *
+ * An Either always needs room for its coroutine handle, so it can never be
+ * smaller than a pointer. It does not have to be larger either: frame
+ * addresses are aligned, which leaves the low bits of the handle free to hold
+ * the discriminant. DATA and ERROR then share the same word when one of them
+ * opts in and the other one is smaller than a pointer:
+ * - a niche carrier, a pointer-sized type whose low bits are always zero, opts
+ *   in through a ropic::niche_traits specialization;
+ * - a type smaller than a pointer opts in through ropic::pack_inline.
+ *
+ * The carrier is stored as is, the small alternative next to the tag byte, so
+ * data() and error() keep returning pointers to the stored values. The word is
+ * read through memcpy and its bytes reinterpreted, so packed Eithers are not
+ * usable in constant expressions; without an opt-in, small payloads keep the
+ * tagged-union storage.
+ */
+
+namespace ropic
+{
+/**
+ * @brief Opt-in description of the invalid bit patterns of `T`.
+ *
+ * Specialize it for a pointer-sized type whose object representation, read as
+ * a `std::uintptr_t`, has its `SPARE_BITS` lowest bits zero for every value
+ * (including the moved-from and null ones). Either uses two spare bits to keep
+ * `Either<T, E>` pointer-sized.
+ *
+ * @code
+ * template <>
+ * struct ropic::niche_traits<Node*> : ropic::pointer_niche<Node> {};
+ * template <>
+ * struct ropic::niche_traits<std::unique_ptr<Node>>
+ *     : ropic::pointer_niche<Node> {};
+ * @endcode
+ */
+template <typename T>
+struct niche_traits
+{
+  static constexpr unsigned SPARE_BITS = 0;
+};
+
+/// @brief niche_traits of a pointer, or pointer wrapper, to a `POINTEE`;
+/// its low bits are zero because of the pointee's alignment.
+template <typename POINTEE>
+struct pointer_niche
+{
+  static constexpr unsigned SPARE_BITS = std::countr_zero(alignof(POINTEE));
+};
+
+/**
+ * @brief Opt-in for a type smaller than a pointer to share the word of the
+ * coroutine handle, next to the tag byte.
+ *
+ * @code
+ * enum class LookupError : std::uint8_t { NOT_FOUND, EXPIRED };
+ * template <>
+ * struct ropic::pack_inline<LookupError> : std::true_type {};
+ *
+ * static_assert(sizeof(ropic::Either<int, LookupError>) == sizeof(void*));
+ * static_assert(sizeof(ropic::Either<void, LookupError>) == sizeof(void*));
+ * @endcode
+ */
+template <typename T>
+struct pack_inline : std::false_type
+{
+};
+
+/// @brief Shorthand for `pack_inline<T>::value`.
+template <typename T>
+inline constexpr bool pack_inline_v = pack_inline<T>::value;
+
+namespace detail
+{
+/// Type occupying a whole word and always holding zero in its two low bits.
+template <typename T>
+concept niche_carrier = sizeof(T) == sizeof(std::uintptr_t)
+                     && niche_traits<T>::SPARE_BITS >= 2;
+
+/// Type small enough to sit next to the tag byte in a word.
+template <typename T>
+concept niche_inline = sizeof(T) < sizeof(std::uintptr_t);
+
+/// Type opted in to sharing the handle's word: a niche carrier, or a small
+/// type declared through ropic::pack_inline.
+template <typename T>
+concept niche_opted_in =
+    niche_carrier<T> || (niche_inline<T> && pack_inline_v<T>);
+
+/// True if NicheEitherStorage can hold DATA and ERROR in one word: one of them
+/// opts in and the other one is small enough to sit next to it.
+template <typename DATA, typename ERROR>
+inline constexpr bool FITS_NICHE_STORAGE =
+    (std::endian::native == std::endian::little
+     || std::endian::native == std::endian::big)
+    && ((niche_opted_in<DATA> && niche_inline<ERROR>)
+        || (niche_inline<DATA> && niche_opted_in<ERROR>));
+
+/**
+ * @brief EitherStorage packed into a single word.
+ *
+ * The two low bits of the word select the alternative:
+ * - `01`: the handle, stored as its frame address plus one;
+ * - `00`: the niche carrier, stored as is (DATA if none is a carrier);
+ * - `10`: the other alternative, stored in the bytes beyond the tag byte.
+ *
+ * Has the same interface as EitherStorage.
+ *
+ * @tparam HANDLE A std::coroutine_handle; frame addresses must leave the two
+ * low bits free.
+ */
+template <typename HANDLE, typename DATA, typename ERROR>
+class NicheEitherStorage
+{
+  static_assert(FITS_NICHE_STORAGE<DATA, ERROR>);
+
+  using Word = std::uintptr_t;
+
+  static constexpr std::size_t WORD_SIZE = sizeof(Word);
+  static constexpr Word TAG_MASK = 0b11;
+  static constexpr Word TAG_HANDLE = 0b01;
+  static constexpr Word TAG_DATA = niche_carrier<ERROR> ? 0b10 : 0b00;
+  static constexpr Word TAG_ERROR = niche_carrier<ERROR> ? 0b00 : 0b10;
+
+  /// Index of the byte holding the two low bits of the word.
+  static constexpr std::size_t TAG_BYTE =
+      std::endian::native == std::endian::little ? 0 : WORD_SIZE - 1;
+
+  alignas(Word) std::byte _bytes[WORD_SIZE];
+
+  template <typename T>
+  static constexpr Word TAG_OF = std::is_same_v<T, DATA> ? TAG_DATA : TAG_ERROR;
+
+  /// Byte offset of alternative `T`; small ones stay clear of the tag byte.
+  template <typename T>
+  static constexpr std::size_t OFFSET_OF =
+      niche_carrier<T> || std::endian::native == std::endian::big
+        ? 0
+        : WORD_SIZE - sizeof(T);
+
+  template <typename T>
+  static constexpr void _checkAlternative() noexcept
+  {
+    static_assert(
+        std::is_same_v<T, DATA> || std::is_same_v<T, ERROR>,
+        "T must be DATA or ERROR");
+  }
+
+  [[nodiscard]]
+  auto _word() const noexcept -> Word
+  {
+    Word word;
+    std::memcpy(&word, _bytes, WORD_SIZE);
+    return word;
+  }
+
+  void _setWord(Word word) noexcept { std::memcpy(_bytes, &word, WORD_SIZE); }
+
+  [[nodiscard]]
+  auto _tag() const noexcept -> Word
+  {
+    return _word() & TAG_MASK;
+  }
+
+  template <typename T>
+  [[nodiscard]]
+  auto _member() noexcept -> T*
+  {
+    return std::launder(reinterpret_cast<T*>(_bytes + OFFSET_OF<T>));
+  }
+
+  template <typename T>
+  [[nodiscard]]
+  auto _member() const noexcept -> const T*
+  {
+    return std::launder(reinterpret_cast<const T*>(_bytes + OFFSET_OF<T>));
+  }
+
+  /// Builds a `T` over a null handle, then switches the tag to it.
+  template <typename T, typename... ARGS>
+  void _construct(ARGS&&... args)
+      noexcept(std::is_nothrow_constructible_v<T, ARGS&&...>)
+  {
+    if constexpr (std::is_nothrow_constructible_v<T, ARGS&&...>)
+    {
+      ::new (static_cast<void*>(_bytes + OFFSET_OF<T>))
+          T(std::forward<ARGS>(args)...);
+    }
+    else
+    {
+      try
+      {
+        ::new (static_cast<void*>(_bytes + OFFSET_OF<T>))
+            T(std::forward<ARGS>(args)...);
+      }
+      catch (...)
+      {
+        _setWord(TAG_HANDLE);
+        throw;
+      }
+    }
+
+    if constexpr (niche_carrier<T>)
+      assert(_tag() == TAG_OF<T> && "niche_traits: low bits must be zero");
+    else
+      _bytes[TAG_BYTE] = static_cast<std::byte>(TAG_OF<T>);
+  }
+
+  /// Destroys the current alternative and leaves a null handle.
+  void _reset() noexcept
+  {
+    const Word tag = _tag();
+    if (tag == TAG_DATA)
+      _member<DATA>()->~DATA();
+    else if (tag == TAG_ERROR)
+      _member<ERROR>()->~ERROR();
+    _setWord(TAG_HANDLE);
+  }
+
+  /// Constructs from `other`; `*this` must hold a null handle.
+  void _moveFrom(NicheEitherStorage& other) noexcept(
+      std::is_nothrow_move_constructible_v<DATA>
+      && std::is_nothrow_move_constructible_v<ERROR>)
+  {
+    const Word tag = other._tag();
+    if (tag == TAG_DATA)
+      _construct<DATA>(std::move(*other._member<DATA>()));
+    else if (tag == TAG_ERROR)
+      _construct<ERROR>(std::move(*other._member<ERROR>()));
+    else
+      _setWord(other._word());
+  }
+
+public:
+  /// @brief Constructs the `T` alternative from `args`.
+  template <typename T, typename... ARGS>
+  explicit NicheEitherStorage(std::in_place_type_t<T> /*type*/, ARGS&&... args)
+      noexcept(std::is_nothrow_constructible_v<T, ARGS&&...>)
+  {
+    _setWord(TAG_HANDLE);
+    emplace<T>(std::forward<ARGS>(args)...);
+  }
+
+  /// @brief Moves the alternative held by `other`; `other` keeps a
+  /// moved-from value of the same alternative.
+  NicheEitherStorage(NicheEitherStorage&& other) noexcept(
+      std::is_nothrow_move_constructible_v<DATA>
+      && std::is_nothrow_move_constructible_v<ERROR>)
+  {
+    _setWord(TAG_HANDLE);
+    _moveFrom(other);
+  }
+
+  /// @brief Replaces the current alternative with the one held by `other`.
+  auto operator=(NicheEitherStorage&& other) noexcept(
+      std::is_nothrow_move_constructible_v<DATA>
+      && std::is_nothrow_move_constructible_v<ERROR>) -> NicheEitherStorage&
+  {
+    if (this != &other)
+    {
+      _reset();
+      _moveFrom(other);
+    }
+    return *this;
+  }
+
+  NicheEitherStorage(const NicheEitherStorage&) = delete;
+  auto operator=(const NicheEitherStorage&) -> NicheEitherStorage& = delete;
+
+  ~NicheEitherStorage() { _reset(); }
+
+  /// @brief Replaces the current alternative with a `T` built from `args`.
+  template <typename T, typename... ARGS>
+  void emplace(ARGS&&... args)
+      noexcept(std::is_nothrow_constructible_v<T, ARGS&&...>)
+  {
+    _reset();
+    if constexpr (std::is_same_v<T, HANDLE>)
+    {
+      const auto address = reinterpret_cast<Word>(
+          HANDLE(std::forward<ARGS>(args)...).address());
+      assert((address & TAG_MASK) == 0 && "Misaligned coroutine frame");
+      _setWord(address | TAG_HANDLE);
+    }
+    else
+    {
+      _checkAlternative<T>();
+      _construct<T>(std::forward<ARGS>(args)...);
+    }
+  }
+
+  /// @brief Returns the stored handle, or a null one if a result is held.
+  [[nodiscard]]
+  auto handle() const noexcept -> HANDLE
+  {
+    const Word word = _word();
+    if ((word & TAG_MASK) != TAG_HANDLE)
+      return HANDLE{};
+    return HANDLE::from_address(reinterpret_cast<void*>(word & ~TAG_MASK));
+  }
+
+  /// @brief Returns true if the `T` alternative is held.
+  template <typename T>
+  [[nodiscard]]
+  auto holds() const noexcept -> bool
+  {
+    if constexpr (std::is_same_v<T, HANDLE>)
+      return _tag() == TAG_HANDLE;
+    else
+      return _tag() == TAG_OF<T>;
+  }
+
+  /// @brief Returns the `T` alternative, or nullptr if another one is held.
+  template <typename T>
+  [[nodiscard]]
+  auto getIf() noexcept -> T*
+  {
+    _checkAlternative<T>();
+    return _tag() == TAG_OF<T> ? _member<T>() : nullptr;
+  }
+
+  /// @copydoc getIf()
+  template <typename T>
+  [[nodiscard]]
+  auto getIf() const noexcept -> const T*
+  {
+    _checkAlternative<T>();
+    return _tag() == TAG_OF<T> ? _member<T>() : nullptr;
+  }
+};
+} // namespace detail
+} // namespace ropic
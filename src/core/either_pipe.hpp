@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "either_impl.hpp"
+#include "void.hpp"
+
+namespace ropic::detail
+{
+/// @brief Data handed to the next step by a step returning `OUT`: the data of
+/// an EitherImpl, Unit for void, `OUT` itself otherwise.
+template <typename OUT, bool IS_EITHER = EitherTraits<OUT>::IS_EITHER>
+struct StepData
+{
+  using Type = DataOf<OUT>;
+};
+
+template <typename OUT>
+struct StepData<OUT, true>
+{
+  using Type = typename EitherTraits<OUT>::Data;
+};
+
+/// @brief Data left after running `STEPS` on a `T`.
+template <typename T, typename... STEPS>
+struct PipeData
+{
+  using Type = T;
+};
+
+template <typename T, typename STEP, typename... REST>
+struct PipeData<T, STEP, REST...>
+{
+  using Type = typename PipeData<
+      typename StepData<DataInvokeResult<const STEP&, T>>::Type,
+      REST...>::Type;
+};
+
+/**
+ * @class Pipeline
+ * @brief Steps fused by ropic::pipe() into a single function over an
+ * EitherImpl.
+ *
+ * Each step takes the data left by the previous one and returns either a
+ * plain value (like map) or an EitherImpl with the same ERROR (like
+ * and_then). Plain values are handed to the next step as rvalue references
+ * to temporaries, so no intermediate EitherImpl is built for them; the first
+ * error skips the remaining steps. Only the returned EitherImpl is built.
+ *
+ * @tparam STEPS Decayed callables, invoked as const lvalues.
+ */
+template <typename... STEPS>
+class Pipeline
+{
+  static_assert(sizeof...(STEPS) > 0, "A pipeline needs at least one step");
+
+  std::tuple<STEPS...> _steps;
+
+  /// @brief Calls `step` on the moved `value`, or with no argument for Unit.
+  template <typename T, typename STEP>
+  static constexpr auto _invoke(const STEP& step, T&& value) -> decltype(auto)
+  {
+    if constexpr (std::is_same_v<T, Unit>)
+      return std::invoke(step);
+    else
+      return std::invoke(step, std::move(value));
+  }
+
+  /// @brief Runs the steps from `I` on, then builds the RESULT.
+  /// @tparam T The data type reaching step `I` (not a reference).
+  template <std::size_t I, typename RESULT, typename T>
+  constexpr auto _run(T&& value) const -> RESULT
+  {
+    if constexpr (I == sizeof...(STEPS))
+    {
+      return RESULT{std::in_place_type<T>, std::move(value)};
+    }
+    else
+    {
+      using Step = std::tuple_element_t<I, std::tuple<STEPS...>>;
+      using Out = DataInvokeResult<const Step&, T>;
+      using Next = typename StepData<Out>::Type;
+      const Step& step = std::get<I>(_steps);
+      if constexpr (EitherTraits<Out>::IS_EITHER)
+      {
+        static_assert(
+            std::is_same_v<
+                typename EitherTraits<Out>::Error,
+                typename EitherTraits<RESULT>::Error>,
+            "Pipeline steps must return an Either with the same `ERROR` type");
+        Out out = _invoke<T>(step, std::move(value));
+        assert(out.done() && "Pipeline steps must return a finished Either");
+        if (auto* stored = out._storedError())
+          return RESULT{
+              std::in_place_type<typename RESULT::Stored>, std::move(*stored)};
+        return _run<I + 1, RESULT, Next>(
+            std::move(*out._result.template getIf<Next>()));
+      }
+      else if constexpr (std::is_void_v<Out>)
+      {
+        _invoke<T>(step, std::move(value));
+        return _run<I + 1, RESULT, Unit>(Unit::OK);
+      }
+      else
+      {
+        return _run<I + 1, RESULT, Next>(_invoke<T>(step, std::move(value)));
+      }
+    }
+  }
+
+public:
+  /// @brief Stores the steps.
+  template <typename... ARGS>
+  constexpr explicit Pipeline(std::in_place_t /*tag*/, ARGS&&... steps)
+      : _steps(std::forward<ARGS>(steps)...)
+  {
+  }
+
+  /**
+   * @brief Runs the steps on the data of `input`, consuming it.
+   * @return The data left by the last step, or the first error.
+   * @pre input.done()
+   */
+  template <typename DATA, typename ERROR>
+  constexpr auto operator()(EitherImpl<DATA, ERROR>&& input) const
+      -> EitherImpl<typename PipeData<DATA, STEPS...>::Type, ERROR>
+  {
+    using Result = EitherImpl<typename PipeData<DATA, STEPS...>::Type, ERROR>;
+    assert(input.done() && "Pipelines need a finished EitherImpl");
+    if (auto* stored = input._storedError())
+      return Result{
+          std::in_place_type<typename Result::Stored>, std::move(*stored)};
+    return _run<0, Result, DATA>(
+        std::move(*input._result.template getIf<DATA>()));
+  }
+};
+} // namespace ropic::detail
+
+namespace ropic
+{
+/**
+ * @brief Fuses `steps` into one function from an Either to an Either.
+ *
+ * `pipe(f, g, h)(std::move(e))` gives the same result as
+ * `std::move(e).map(f).and_then(g).map(h)` (whichever of map or and_then
+ * fits each step) without building an Either between the steps.
+ *
+ * @code
+ * auto validateName = ropic::pipe(trim, checkNotEmpty, toLower, checkAscii);
+ * Either<std::string, Error> name = validateName(readField("name"));
+ * @endcode
+ */
+template <typename... STEPS>
+[[nodiscard]]
+constexpr auto pipe(STEPS&&... steps)
+    -> detail::Pipeline<std::decay_t<STEPS>...>
+{
+  return detail::Pipeline<std::decay_t<STEPS>...>{
+      std::in_place, std::forward<STEPS>(steps)...};
+}
+} // namespace ropic
@@ -6,8 +6,12 @@
 #include <cassert>
 #include <coroutine>
 #include <exception>
+#include <tuple>
+#include <utility>
 
 #include "either_impl.hpp"
+#include "frame_promise.hpp"
+#include "frame_reserve.hpp"
 
 namespace ropic::detail
 {
@@ -19,7 +23,7 @@ namespace ropic::detail
  * and stores co_return values directly into the associated EitherImpl.
  */
 template <typename DATA, typename ERROR>
-class EitherImpl<DATA, ERROR>::Promise
+class EitherImpl<DATA, ERROR>::Promise : public FramePromise<EitherImpl>
 {
   EitherImpl* _either = nullptr;
 
@@ -33,6 +37,13 @@ public:
     _either = either;
   }
 
+  /// @brief Returns the EitherImpl this promise is currently bound to.
+  [[nodiscard]]
+  auto either() const noexcept -> EitherImpl&
+  {
+    return *_either;
+  }
+
   // NOLINTBEGIN(readability-identifier-naming)
   /// @brief Creates EitherImpl bound to this promise's coroutine handle.
   [[nodiscard]]
@@ -48,21 +59,61 @@ public:
     return {};
   }
 
-  /// @brief Handles co_return with a DATA value.
-  void return_value(DATA value)
-      noexcept(std::is_nothrow_move_assignable_v<DATA>)
+  /// @brief Handles co_return with a DATA value, moved into the result.
+  void return_value(DATA&& value)
+      noexcept(std::is_nothrow_move_constructible_v<DATA>)
   {
     _either->_setDataAndNullifyHandle(std::move(value));
   }
 
-  /// @brief Handles co_return with an ERROR value.
+  /// @brief Handles co_return with a DATA value, copied into the result.
+  void return_value(const DATA& value)
+      noexcept(std::is_nothrow_copy_constructible_v<DATA>)
+  {
+    _either->_setDataAndNullifyHandle(value);
+  }
 
-  void return_value(ERROR value)
-      noexcept(std::is_nothrow_move_assignable_v<ERROR>)
+  /// @brief Handles co_return with an ERROR value, moved into the result.
+  void return_value(ERROR&& value) noexcept(noexcept(
+      std::declval<EitherImpl&>()._setErrorAndNullifyHandle(
+          std::declval<ERROR&&>())))
   {
     _either->_setErrorAndNullifyHandle(std::move(value));
   }
 
+  /// @brief Handles co_return with an ERROR value, copied into the result.
+  void return_value(const ERROR& value) noexcept(noexcept(
+      std::declval<EitherImpl&>()._setErrorAndNullifyHandle(
+          std::declval<const ERROR&>())))
+  {
+    _either->_setErrorAndNullifyHandle(value);
+  }
+
+  /// @brief Handles `co_return ropic::in_place(args...)`: constructs DATA
+  /// directly in the result.
+  template <typename... ARGS>
+  void return_value(InPlaceData<ARGS...> place)
+      noexcept(std::is_nothrow_constructible_v<DATA, ARGS&&...>)
+  {
+    std::apply(
+        [this](ARGS&&... args)
+        { _either->_setDataAndNullifyHandle(std::forward<ARGS>(args)...); },
+        std::move(place.args));
+  }
+
+  /// @brief Handles `co_return ropic::in_place_error(args...)`: constructs
+  /// ERROR directly in the result.
+  template <typename... ARGS>
+  void return_value(InPlaceError<ARGS...> place) noexcept(
+      noexcept(std::declval<EitherImpl&>()._setErrorAndNullifyHandle(
+          std::declval<ARGS&&>()...)))
+  {
+    std::apply(
+        [this](ARGS&&... args)
+        { _either->_setErrorAndNullifyHandle(std::forward<ARGS>(args)...); },
+        std::move(place.args));
+  }
+
   /// @brief Suspends at coroutine end.
   [[nodiscard]]
   auto final_suspend() noexcept -> std::suspend_never
@@ -97,6 +148,66 @@ public:
   {
     return PropagatingAwaiter<OTHER, true>{awaitable, *_either};
   }
+
+  /// @brief Transforms rvalue ValueEither to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(ValueEither<OTHER, ERROR>&& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, false, ValueEither<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, false, ValueEither<OTHER, ERROR>>{
+        std::move(awaitable), *_either};
+  }
+
+  /// @brief Transforms lvalue ValueEither to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(ValueEither<OTHER, ERROR>& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, true, ValueEither<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, true, ValueEither<OTHER, ERROR>>{
+        awaitable, *_either};
+  }
+
+  /// @brief Transforms rvalue AsyncEitherImpl to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(AsyncEitherImpl<OTHER, ERROR>&& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, false, AsyncEitherImpl<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, false, AsyncEitherImpl<OTHER, ERROR>>{
+        std::move(awaitable), *_either};
+  }
+
+  /// @brief Transforms lvalue AsyncEitherImpl to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(AsyncEitherImpl<OTHER, ERROR>& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, true, AsyncEitherImpl<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, true, AsyncEitherImpl<OTHER, ERROR>>{
+        awaitable, *_either};
+  }
+
+  /// @brief Transforms rvalue SyncEitherImpl to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(SyncEitherImpl<OTHER, ERROR>&& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, false, SyncEitherImpl<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, false, SyncEitherImpl<OTHER, ERROR>>{
+        std::move(awaitable), *_either};
+  }
+
+  /// @brief Transforms lvalue SyncEitherImpl to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(SyncEitherImpl<OTHER, ERROR>& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, true, SyncEitherImpl<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, true, SyncEitherImpl<OTHER, ERROR>>{
+        awaitable, *_either};
+  }
   // NOLINTEND(readability-identifier-naming)
 };
 } // namespace ropic::detail
@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "either_niche.hpp"
+
+namespace ropic::detail
+{
+/**
+ * @brief Three-state tagged union backing EitherImpl.
+ *
+ * Holds exactly one of a coroutine handle (the empty state), DATA or ERROR,
+ * selected by a one-byte tag. Unlike std::variant it has no valueless state:
+ * if constructing a new alternative throws, the storage is left holding a
+ * null handle, i.e. empty. Empty payloads such as Void overlap the other
+ * members and cost nothing beyond the tag. Copying is not supported.
+ *
+ * Every member is constexpr, so value-mode Eithers using this storage can be
+ * built and read in constant expressions.
+ *
+ * @tparam HANDLE Trivially copyable handle type; a value-initialized HANDLE
+ * is the empty state.
+ */
+template <typename HANDLE, typename DATA, typename ERROR>
+class EitherStorage
+{
+  static_assert(
+      std::is_trivially_copyable_v<HANDLE>,
+      "The empty-state handle must be trivially copyable");
+
+  enum class Tag : std::uint8_t
+  {
+    HOLDS_HANDLE,
+    HOLDS_DATA,
+    HOLDS_ERROR,
+  };
+
+  union Payload
+  {
+    HANDLE handle;
+    DATA data;
+    ERROR error;
+
+    constexpr Payload() noexcept : handle() {}
+    Payload(const Payload&) = delete;
+    Payload(Payload&&) = delete;
+    auto operator=(const Payload&) -> Payload& = delete;
+    auto operator=(Payload&&) -> Payload& = delete;
+    constexpr ~Payload() {}
+  };
+
+  Payload _payload;
+  Tag _tag = Tag::HOLDS_HANDLE;
+
+  template <typename T>
+  static constexpr Tag TAG_OF = std::is_same_v<T, HANDLE> ? Tag::HOLDS_HANDLE
+                              : std::is_same_v<T, DATA>   ? Tag::HOLDS_DATA
+                                                          : Tag::HOLDS_ERROR;
+
+  template <typename T, typename PAYLOAD>
+  [[nodiscard]]
+  static constexpr auto _member(PAYLOAD& payload) noexcept
+  {
+    static_assert(
+        std::is_same_v<T, HANDLE> || std::is_same_v<T, DATA>
+            || std::is_same_v<T, ERROR>,
+        "T must be one of the stored alternatives");
+    if constexpr (TAG_OF<T> == Tag::HOLDS_HANDLE)
+      return std::addressof(payload.handle);
+    else if constexpr (TAG_OF<T> == Tag::HOLDS_DATA)
+      return std::addressof(payload.data);
+    else
+      return std::addressof(payload.error);
+  }
+
+  /// Destroys the current alternative and leaves a null handle.
+  constexpr void _reset() noexcept
+  {
+    if (_tag == Tag::HOLDS_DATA)
+      std::destroy_at(std::addressof(_payload.data));
+    else if (_tag == Tag::HOLDS_ERROR)
+      std::destroy_at(std::addressof(_payload.error));
+    std::construct_at(std::addressof(_payload.handle));
+    _tag = Tag::HOLDS_HANDLE;
+  }
+
+  // GCC cannot tell which union member the tag selects once this is inlined
+  // and reports the moved-from member as maybe-uninitialized. The same holds
+  // for the constructors and emplace(), which combinators call with a member
+  // of another storage on branches the tag rules out.
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+  /// Constructs from `other`; `*this` must hold a handle.
+  constexpr void _moveFrom(EitherStorage& other) noexcept(
+      std::is_nothrow_move_constructible_v<DATA>
+      && std::is_nothrow_move_constructible_v<ERROR>)
+  {
+    switch (other._tag)
+    {
+    case Tag::HOLDS_HANDLE:
+      _payload.handle = other._payload.handle;
+      break;
+    case Tag::HOLDS_DATA:
+      std::construct_at(
+          std::addressof(_payload.data), std::move(other._payload.data));
+      break;
+    case Tag::HOLDS_ERROR:
+      std::construct_at(
+          std::addressof(_payload.error), std::move(other._payload.error));
+      break;
+    }
+    _tag = other._tag;
+  }
+
+public:
+  /// @brief Constructs the `T` alternative from `args`.
+  template <typename T, typename... ARGS>
+  constexpr explicit EitherStorage(
+      std::in_place_type_t<T> /*type*/,
+      ARGS&&... args) noexcept(std::is_nothrow_constructible_v<T, ARGS&&...>)
+  {
+    std::construct_at(_member<T>(_payload), std::forward<ARGS>(args)...);
+    _tag = TAG_OF<T>;
+  }
+
+  /// @brief Moves the alternative held by `other`; `other` keeps a
+  /// moved-from value of the same alternative.
+  constexpr EitherStorage(EitherStorage&& other) noexcept(
+      std::is_nothrow_move_constructible_v<DATA>
+      && std::is_nothrow_move_constructible_v<ERROR>)
+  {
+    _moveFrom(other);
+  }
+
+  /// @brief Replaces the current alternative with the one held by `other`.
+  constexpr auto operator=(EitherStorage&& other) noexcept(
+      std::is_nothrow_move_constructible_v<DATA>
+      && std::is_nothrow_move_constructible_v<ERROR>) -> EitherStorage&
+  {
+    if (this != &other)
+    {
+      _reset();
+      _moveFrom(other);
+    }
+    return *this;
+  }
+
+  EitherStorage(const EitherStorage&) = delete;
+  auto operator=(const EitherStorage&) -> EitherStorage& = delete;
+
+  constexpr ~EitherStorage() { _reset(); }
+
+  /// @brief Replaces the current alternative with a `T` built from `args`.
+  template <typename T, typename... ARGS>
+  constexpr void emplace(ARGS&&... args)
+      noexcept(std::is_nothrow_constructible_v<T, ARGS&&...>)
+  {
+    _reset();
+    std::construct_at(_member<T>(_payload), std::forward<ARGS>(args)...);
+    _tag = TAG_OF<T>;
+  }
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic pop
+#endif
+
+  /// @brief Returns the stored handle, or a null one if a result is held.
+  [[nodiscard]]
+  constexpr auto handle() const noexcept -> HANDLE
+  {
+    return _tag == Tag::HOLDS_HANDLE ? _payload.handle : HANDLE{};
+  }
+
+  /// @brief Returns true if the `T` alternative is held.
+  template <typename T>
+  [[nodiscard]]
+  constexpr auto holds() const noexcept -> bool
+  {
+    return _tag == TAG_OF<T>;
+  }
+
+  /// @brief Returns the `T` alternative, or nullptr if another one is held.
+  template <typename T>
+  [[nodiscard]]
+  constexpr auto getIf() noexcept -> T*
+  {
+    return _tag == TAG_OF<T> ? _member<T>(_payload) : nullptr;
+  }
+
+  /// @copydoc getIf()
+  template <typename T>
+  [[nodiscard]]
+  constexpr auto getIf() const noexcept -> const T*
+  {
+    return _tag == TAG_OF<T> ? _member<T>(_payload) : nullptr;
+  }
+};
+
+/// Storage of EitherImpl: a single word when DATA or ERROR opts in to it
+/// (see FITS_NICHE_STORAGE). The single-word layout reinterprets bytes, so it
+/// is not usable in constant expressions.
+template <typename HANDLE, typename DATA, typename ERROR>
+using EitherStorageFor = std::conditional_t<
+    FITS_NICHE_STORAGE<DATA, ERROR>,
+    NicheEitherStorage<HANDLE, DATA, ERROR>,
+    EitherStorage<HANDLE, DATA, ERROR>>;
+} // namespace ropic::detail
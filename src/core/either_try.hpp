@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+/**
+ * @file either_try.hpp
+ * @brief co_await-style error propagation for ordinary functions.
+ *
+ * ROPIC_TRY(expr) unwraps the data of a finished Either or ValueEither, or
+ * returns its error from the enclosing function, which must return an Either
+ * or ValueEither with the same ERROR type. No coroutine frame or promise is
+ * involved, so the enclosing function stays a plain function:
+ *
+ * @code
+ * ropic::Either<int, Error> sum(std::string_view a, std::string_view b) {
+ *     int x = ROPIC_TRY(parseInt(a));
+ *     int y = ROPIC_TRY(parseInt(b));
+ *     return x + y;
+ * }
+ * @endcode
+ *
+ * The Either given to ROPIC_TRY is consumed, like with takeData().
+ *
+ * ROPIC_TRY is an expression on GCC and Clang, which support statement
+ * expressions (ROPIC_HAS_TRY_EXPRESSION is 1). Elsewhere it can only be used
+ * as a statement, discarding the data; ROPIC_TRY_ASSIGN keeps it everywhere:
+ *
+ * @code
+ * ROPIC_TRY_ASSIGN(int x, parseInt(a));
+ * @endcode
+ */
+
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+#include "attributes.hpp"
+#include "either_impl.hpp"
+#include "value_either.hpp"
+
+namespace ropic::detail
+{
+/// @brief Payload types of an Either or ValueEither given to ROPIC_TRY.
+template <typename SOURCE>
+struct TryTraits;
+
+template <typename DATA, typename ERROR>
+struct TryTraits<EitherImpl<DATA, ERROR>>
+{
+  static constexpr bool IS_VALUE_EITHER = false;
+  using Data = DATA;
+  using Error = ERROR;
+};
+
+template <typename DATA, typename ERROR>
+struct TryTraits<ValueEither<DATA, ERROR>>
+{
+  static constexpr bool IS_VALUE_EITHER = true;
+  using Data = DATA;
+  using Error = ERROR;
+};
+
+/**
+ * @class PropagatedError
+ * @brief Error of the Either given to ROPIC_TRY, converted to the Either
+ * returned by the enclosing function.
+ *
+ * Between two Eithers the stored error (or its box) moves over as is.
+ */
+template <typename SOURCE>
+class PropagatedError
+{
+  using Error = typename TryTraits<SOURCE>::Error;
+
+  SOURCE& _source;
+
+public:
+  explicit PropagatedError(SOURCE& source) noexcept : _source(source)
+  {
+    assert(source.error() && "`source` must hold an error");
+  }
+
+  /// @brief Moves the error into the returned EitherImpl.
+  template <typename DATA, typename ERROR>
+  operator EitherImpl<DATA, ERROR>() &&
+  {
+    static_assert(
+        std::is_same_v<Error, ERROR>,
+        "ROPIC_TRY needs the enclosing function to return the same `ERROR`");
+    if constexpr (TryTraits<SOURCE>::IS_VALUE_EITHER)
+    {
+      return EitherImpl<DATA, ERROR>{std::move(_source).takeError()};
+    }
+    else
+    {
+      using Stored = StoredError<ERROR>;
+      return EitherImpl<DATA, ERROR>{
+          std::in_place_type<Stored>, std::move(*_source._storedError())};
+    }
+  }
+
+  /// @brief Moves the error into the returned ValueEither.
+  template <typename DATA, typename ERROR>
+  operator ValueEither<DATA, ERROR>() &&
+  {
+    static_assert(
+        std::is_same_v<Error, ERROR>,
+        "ROPIC_TRY needs the enclosing function to return the same `ERROR`");
+    return ValueEither<DATA, ERROR>{std::move(_source).takeError()};
+  }
+};
+
+/// @brief Tells whether `source` holds an error.
+template <typename SOURCE>
+[[nodiscard]]
+ROPIC_FORCEINLINE auto tryFailed(const SOURCE& source) noexcept -> bool
+{
+  assert(source.done() && "ROPIC_TRY needs a finished Either");
+  return static_cast<bool>(source.error());
+}
+
+/// @brief Moves the data out of `source`.
+template <typename SOURCE>
+ROPIC_FORCEINLINE auto tryTakeData(SOURCE& source)
+    -> typename TryTraits<SOURCE>::Data
+{
+  return std::move(source).takeData();
+}
+} // namespace ropic::detail
+
+#define ROPIC_TRY_CONCAT_IMPL(a, b) a##b
+#define ROPIC_TRY_CONCAT(a, b) ROPIC_TRY_CONCAT_IMPL(a, b)
+
+/// @brief Declares or assigns `lhs` from the data of `expr`, or returns the
+/// error of `expr` from the enclosing function. Expands to several
+/// statements.
+#define ROPIC_TRY_ASSIGN(lhs, expr)                                            \
+  ROPIC_TRY_ASSIGN_IMPL(lhs, expr, ROPIC_TRY_CONCAT(ropicTry, __COUNTER__))
+
+#define ROPIC_TRY_ASSIGN_IMPL(lhs, expr, source)                               \
+  auto&& source = (expr);                                                      \
+  if (::ropic::detail::tryFailed(source))                                      \
+    return ::ropic::detail::PropagatedError{source};                           \
+  lhs = ::ropic::detail::tryTakeData(source)
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define ROPIC_HAS_TRY_EXPRESSION 1
+/// @brief Evaluates to the data of `expr`, or returns the error of `expr`
+/// from the enclosing function.
+#  define ROPIC_TRY(expr)                                                      \
+    ROPIC_TRY_IMPL(expr, ROPIC_TRY_CONCAT(ropicTry, __COUNTER__))
+#  define ROPIC_TRY_IMPL(expr, source)                                         \
+    __extension__({                                                            \
+      auto&& source = (expr);                                                  \
+      if (::ropic::detail::tryFailed(source))                                  \
+        return ::ropic::detail::PropagatedError{source};                       \
+      ::ropic::detail::tryTakeData(source);                                    \
+    })
+#else
+#  define ROPIC_HAS_TRY_EXPRESSION 0
+/// @brief Returns the error of `expr` from the enclosing function; a
+/// statement, as statement expressions are not available.
+#  define ROPIC_TRY(expr)                                                      \
+    ROPIC_TRY_IMPL(expr, ROPIC_TRY_CONCAT(ropicTry, __COUNTER__))
+#  define ROPIC_TRY_IMPL(expr, source)                                         \
+    do                                                                         \
+    {                                                                          \
+      auto&& source = (expr);                                                  \
+      if (::ropic::detail::tryFailed(source))                                  \
+        return ::ropic::detail::PropagatedError{source};                       \
+    } while (false)
+#endif
@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <bit>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "either_niche.hpp"
+#include "frame_pool.hpp"
+#include "relocation.hpp"
+
+/**
+ * @file error_box.hpp
+ * @brief Out-of-line storage for large, cold ERROR payloads.
+ *
+ * An Either is as large as its largest alternative, so a rich error type
+ * (message strings, context) inflates every result on the success path too.
+ * ERROR types that opt in through ropic::box_error are stored behind a single
+ * pointer instead; the error itself lives in a block of a per-thread pool
+ * dedicated to boxed errors, allocated only when an error is produced.
+ */
+
+namespace ropic
+{
+/**
+ * @brief Opt-in to storing `ERROR` out of line in Either.
+ *
+ * @code
+ * template <>
+ * struct ropic::box_error<Error> : std::true_type {};
+ *
+ * static_assert(sizeof(ropic::Either<int, Error>) == sizeof(void*));
+ * @endcode
+ */
+template <typename ERROR>
+struct box_error : std::false_type
+{
+};
+
+/// @brief Shorthand for `box_error<ERROR>::value`.
+template <typename ERROR>
+inline constexpr bool box_error_v = box_error<ERROR>::value;
+
+namespace detail
+{
+/// Tag of the boxed error pools.
+struct ErrorPoolTag;
+
+/// Per-thread pool of boxed errors.
+using ErrorPool = BasicFramePool<ErrorPoolTag>;
+
+/**
+ * @brief Owning pointer to an ERROR allocated from the ErrorPool.
+ *
+ * A moved-from box is empty. Boxes are pointer-sized with free low bits, so
+ * they are niche carriers for Either storage.
+ */
+template <typename ERROR>
+class ErrorBox
+{
+  static_assert(
+      alignof(ERROR) <= ErrorPool::GRANULARITY,
+      "Over-aligned error types cannot be boxed");
+
+  ERROR* _error;
+
+public:
+  /// @brief Boxes an ERROR constructed from `args`.
+  /// @throws std::bad_alloc if no block can be allocated.
+  template <typename... ARGS>
+  explicit ErrorBox(std::in_place_t /*unused*/, ARGS&&... args)
+      : _error(static_cast<ERROR*>(ErrorPool::allocateFrame(sizeof(ERROR))))
+  {
+    if constexpr (std::is_nothrow_constructible_v<ERROR, ARGS&&...>)
+    {
+      ::new (static_cast<void*>(_error)) ERROR(std::forward<ARGS>(args)...);
+    }
+    else
+    {
+      try
+      {
+        ::new (static_cast<void*>(_error)) ERROR(std::forward<ARGS>(args)...);
+      }
+      catch (...)
+      {
+        ErrorPool::deallocateFrame(_error, sizeof(ERROR));
+        throw;
+      }
+    }
+  }
+
+  /// @brief Boxes `error`.
+  /// @throws std::bad_alloc if no block can be allocated.
+  explicit ErrorBox(ERROR&& error) : ErrorBox(std::in_place, std::move(error))
+  {
+  }
+
+  ErrorBox(ErrorBox&& other) noexcept
+      : _error(std::exchange(other._error, nullptr))
+  {
+  }
+
+  auto operator=(ErrorBox&& other) noexcept -> ErrorBox&
+  {
+    if (this != &other)
+    {
+      _destroy();
+      _error = std::exchange(other._error, nullptr);
+    }
+    return *this;
+  }
+
+  ErrorBox(const ErrorBox&) = delete;
+  auto operator=(const ErrorBox&) -> ErrorBox& = delete;
+
+  ~ErrorBox() { _destroy(); }
+
+  /// @brief Returns the boxed error, or nullptr if moved from.
+  [[nodiscard]]
+  auto get() const noexcept -> ERROR*
+  {
+    return _error;
+  }
+
+private:
+  void _destroy() noexcept
+  {
+    if (_error)
+    {
+      std::destroy_at(_error);
+      ErrorPool::deallocateFrame(_error, sizeof(ERROR));
+    }
+  }
+};
+
+/// Type EitherImpl stores for ERROR: the error itself, or its box.
+template <typename ERROR>
+using StoredError =
+    std::conditional_t<box_error_v<ERROR>, ErrorBox<ERROR>, ERROR>;
+
+/// @brief Returns the error held in `stored`, or nullptr.
+template <typename ERROR>
+[[nodiscard]]
+constexpr auto unboxError(StoredError<ERROR>* stored) noexcept -> ERROR*
+{
+  if constexpr (box_error_v<ERROR>)
+    return stored ? stored->get() : nullptr;
+  else
+    return stored;
+}
+
+/// @copydoc unboxError()
+template <typename ERROR>
+[[nodiscard]]
+constexpr auto unboxError(const StoredError<ERROR>* stored) noexcept
+    -> const ERROR*
+{
+  if constexpr (box_error_v<ERROR>)
+    return stored ? stored->get() : nullptr;
+  else
+    return stored;
+}
+} // namespace detail
+
+/// A box is an owning pointer with no address identity.
+template <typename ERROR>
+struct is_trivially_relocatable<detail::ErrorBox<ERROR>> : std::true_type
+{
+};
+
+/// Pool blocks are GRANULARITY-aligned, which leaves the box's low bits free.
+template <typename ERROR>
+struct niche_traits<detail::ErrorBox<ERROR>>
+{
+  static constexpr unsigned SPARE_BITS =
+      std::countr_zero(detail::ErrorPool::GRANULARITY);
+};
+} // namespace ropic
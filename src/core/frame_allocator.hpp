@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include "frame_arena.hpp"
+#include "frame_pool.hpp"
+#include "frame_resource.hpp"
+#include "frame_stack.hpp"
+
+/**
+ * @file frame_allocator.hpp
+ * @brief Frame allocation entry points used by the Either promise.
+ *
+ * Every frame allocated through the promise carries a small trailer after the
+ * coroutine state that records how the frame must be released. This lets one
+ * promise operator delete serve frames coming from the frame pool, the global
+ * heap, an active FrameArena, a std::pmr::memory_resource and user allocators
+ * passed with `std::allocator_arg`.
+ *
+ * Frame layout:
+ * @code
+ * | coroutine frame (size) | pad | FrameDeallocator | pad | allocator copy |
+ * @endcode
+ * The allocator copy is only present for stateful allocators. Frames from a
+ * memory resource store the resource pointer in its place.
+ */
+
+namespace ropic::detail
+{
+/// Storage unit that allocator-placed frames are carved in.
+struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) FrameUnit
+{
+  std::byte bytes[__STDCPP_DEFAULT_NEW_ALIGNMENT__];
+};
+
+/// Releases a frame; `size` is the size the compiler requested for it.
+using FrameDeallocator = void (*)(void* frame, std::size_t size) noexcept;
+
+/// @brief Rounds `size` up to a multiple of `alignment` (a power of two).
+[[nodiscard]]
+constexpr auto alignFrameSize(std::size_t size, std::size_t alignment) noexcept
+    -> std::size_t
+{
+  return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/// @brief Offset of the FrameDeallocator trailer in a frame of `size` bytes.
+[[nodiscard]]
+constexpr auto frameTrailerOffset(std::size_t size) noexcept -> std::size_t
+{
+  return alignFrameSize(size, alignof(FrameDeallocator));
+}
+
+/// @brief Bytes needed for a frame of `size` bytes plus its trailer.
+[[nodiscard]]
+constexpr auto frameAllocationSize(std::size_t size) noexcept -> std::size_t
+{
+  return frameTrailerOffset(size) + sizeof(FrameDeallocator);
+}
+
+/// @brief Writes the trailer of `frame` and returns `frame`.
+inline auto
+stampFrame(void* frame, std::size_t size, FrameDeallocator deallocator) noexcept
+    -> void*
+{
+  ::new (static_cast<std::byte*>(frame) + frameTrailerOffset(size))
+      FrameDeallocator{deallocator};
+  return frame;
+}
+
+/// @brief Returns the frame to the pool (or global heap) it came from.
+inline void deallocateDefaultFrame(void* frame, std::size_t size) noexcept
+{
+#if ROPIC_FRAME_POOL
+  FramePool::deallocateFrame(frame, frameAllocationSize(size));
+#else
+  ::operator delete(frame, frameAllocationSize(size));
+#endif
+}
+
+/// @brief Pops the frame from the frame stack it came from.
+inline void deallocateStackFrame(void* frame, std::size_t /*size*/) noexcept
+{
+  FrameStack::deallocateFrame(frame);
+}
+
+/// @brief Arena frames are released in bulk when their FrameArena ends.
+inline void deallocateArenaFrame(
+    void* /*frame*/, std::size_t /*size*/) noexcept
+{
+}
+
+/// @brief Offset of the memory resource pointer in a frame of `size` bytes.
+[[nodiscard]]
+constexpr auto frameResourceOffset(std::size_t size) noexcept -> std::size_t
+{
+  return alignFrameSize(
+      frameAllocationSize(size), alignof(std::pmr::memory_resource*));
+}
+
+/// @brief Bytes needed for a resource frame of `size` bytes.
+[[nodiscard]]
+constexpr auto frameResourceAllocationSize(std::size_t size) noexcept
+    -> std::size_t
+{
+  return frameResourceOffset(size) + sizeof(std::pmr::memory_resource*);
+}
+
+/// @brief Returns the frame to the memory resource recorded in it.
+inline void deallocateResourceFrame(void* frame, std::size_t size) noexcept
+{
+  auto* resource = *std::launder(reinterpret_cast<std::pmr::memory_resource**>(
+      static_cast<std::byte*>(frame) + frameResourceOffset(size)));
+  resource->deallocate(
+      frame, frameResourceAllocationSize(size), alignof(FrameUnit));
+}
+
+/// @brief Allocates a frame from `resource` and records it in the frame.
+[[nodiscard]]
+inline auto
+allocateResourceFrame(std::size_t size, std::pmr::memory_resource* resource)
+    -> void*
+{
+  void* frame =
+      resource->allocate(frameResourceAllocationSize(size), alignof(FrameUnit));
+  ::new (static_cast<std::byte*>(frame) + frameResourceOffset(size))
+      std::pmr::memory_resource*{resource};
+  return stampFrame(frame, size, &deallocateResourceFrame);
+}
+
+/// @brief Allocates a frame from the active FrameArena, the current memory
+/// resource, the thread-local frame stack (if enabled), or else the
+/// thread-local pool (or global heap).
+[[nodiscard]]
+inline auto allocateFrame(std::size_t size) -> void*
+{
+  if (FrameArena* arena = FrameArena::active())
+  {
+    return stampFrame(
+        arena->allocate(frameAllocationSize(size)),
+        size,
+        &deallocateArenaFrame);
+  }
+
+  if (std::pmr::memory_resource* resource = currentFrameResource())
+    return allocateResourceFrame(size, resource);
+
+#if ROPIC_FRAME_STACK
+  if (void* frame = FrameStack::allocateFrame(frameAllocationSize(size)))
+    return stampFrame(frame, size, &deallocateStackFrame);
+#endif
+
+#if ROPIC_FRAME_POOL
+  void* frame = FramePool::allocateFrame(frameAllocationSize(size));
+#else
+  void* frame = ::operator new(frameAllocationSize(size));
+#endif
+  return stampFrame(frame, size, &deallocateDefaultFrame);
+}
+
+/**
+ * @brief Frame placement through a user allocator, `std::generator` style.
+ *
+ * @tparam ALLOC Allocator type passed after `std::allocator_arg`. It is
+ * rebound to FrameUnit; stateful allocators are copied into the frame so the
+ * frame can be released without the caller's allocator.
+ */
+template <typename ALLOC>
+class AllocatorFrame
+{
+  using UnitAllocator =
+      typename std::allocator_traits<ALLOC>::template rebind_alloc<FrameUnit>;
+  using UnitTraits = std::allocator_traits<UnitAllocator>;
+
+  static constexpr bool STORES_ALLOCATOR =
+      !UnitTraits::is_always_equal::value
+      || !std::is_default_constructible_v<UnitAllocator>;
+
+  static_assert(
+      alignof(UnitAllocator) <= alignof(FrameUnit),
+      "Over-aligned allocators are not supported for coroutine frames");
+
+  [[nodiscard]]
+  static constexpr auto _allocatorOffset(std::size_t size) noexcept
+      -> std::size_t
+  {
+    return alignFrameSize(frameAllocationSize(size), alignof(UnitAllocator));
+  }
+
+  [[nodiscard]]
+  static constexpr auto _unitCount(std::size_t size) noexcept -> std::size_t
+  {
+    const std::size_t bytes = STORES_ALLOCATOR
+                                ? _allocatorOffset(size) + sizeof(UnitAllocator)
+                                : frameAllocationSize(size);
+    return alignFrameSize(bytes, sizeof(FrameUnit)) / sizeof(FrameUnit);
+  }
+
+  static void _deallocate(void* frame, std::size_t size) noexcept
+  {
+    auto* units = static_cast<FrameUnit*>(frame);
+    if constexpr (STORES_ALLOCATOR)
+    {
+      auto* stored = std::launder(reinterpret_cast<UnitAllocator*>(
+          static_cast<std::byte*>(frame) + _allocatorOffset(size)));
+      UnitAllocator allocator{std::move(*stored)};
+      stored->~UnitAllocator();
+      UnitTraits::deallocate(allocator, units, _unitCount(size));
+    }
+    else
+    {
+      UnitAllocator allocator{};
+      UnitTraits::deallocate(allocator, units, _unitCount(size));
+    }
+  }
+
+public:
+  /// @brief Allocates a frame of `size` bytes from `allocator`.
+  [[nodiscard]]
+  static auto allocate(std::size_t size, const ALLOC& allocator) -> void*
+  {
+    UnitAllocator unitAllocator{allocator};
+    void* frame = UnitTraits::allocate(unitAllocator, _unitCount(size));
+    if constexpr (STORES_ALLOCATOR)
+    {
+      ::new (static_cast<std::byte*>(frame) + _allocatorOffset(size))
+          UnitAllocator{std::move(unitAllocator)};
+    }
+    return stampFrame(frame, size, &_deallocate);
+  }
+};
+
+/// @brief Releases a frame through the deallocator recorded in its trailer.
+inline void deallocateFrame(void* frame, std::size_t size) noexcept
+{
+  const FrameDeallocator deallocator =
+      *std::launder(reinterpret_cast<FrameDeallocator*>(
+          static_cast<std::byte*>(frame) + frameTrailerOffset(size)));
+  deallocator(frame, size);
+}
+} // namespace ropic::detail
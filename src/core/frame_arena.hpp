@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <new>
+
+namespace ropic
+{
+/**
+ * @brief Scoped, thread-local monotonic arena for Either coroutine frames.
+ *
+ * While a FrameArena is alive, every Either frame allocated on the same thread
+ * (without an explicit `std::allocator_arg` allocator) is bump-allocated from
+ * it. Destroying a frame is a no-op; all memory is released in bulk when the
+ * arena goes out of scope. Arenas nest: the innermost one is used.
+ *
+ * @warning Every frame allocated from the arena must be destroyed before the
+ * arena is. Do not let coroutines that are still suspended (e.g. awaiting an
+ * async operation) escape the scope.
+ *
+ * @code
+ * auto handleRequest(const Request& request) -> Response
+ * {
+ *     ropic::FrameArena arena;
+ *     auto saved = processAndSave(request.x, request.y, request.file);
+ *     ...
+ * } // every frame of the request released here
+ * @endcode
+ */
+class FrameArena
+{
+public:
+  /// Default capacity of each heap chunk.
+  static constexpr std::size_t DEFAULT_CHUNK_SIZE = std::size_t{16} * 1024;
+
+private:
+  static constexpr std::size_t ALIGNMENT = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+  /// Header of a heap chunk; the usable bytes follow it.
+  struct alignas(ALIGNMENT) Chunk
+  {
+    Chunk* next;
+    std::size_t size;
+  };
+
+  std::byte* _cursor = nullptr;
+  std::byte* _end = nullptr;
+  Chunk* _chunks = nullptr;
+  std::size_t _chunkSize;
+  std::size_t _bytesAllocated = 0;
+  FrameArena* _previous;
+
+  static auto _active() noexcept -> FrameArena*&
+  {
+    thread_local FrameArena* active = nullptr;
+    return active;
+  }
+
+  [[nodiscard]]
+  static constexpr auto _align(std::size_t size) noexcept -> std::size_t
+  {
+    return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+  }
+
+  void _grow(std::size_t minimum)
+  {
+    const std::size_t size = minimum > _chunkSize ? minimum : _chunkSize;
+    void* memory = ::operator new(sizeof(Chunk) + size);
+    _chunks = ::new (memory) Chunk{.next = _chunks, .size = size};
+    _cursor = reinterpret_cast<std::byte*>(_chunks + 1);
+    _end = _cursor + size;
+  }
+
+public:
+  /**
+   * @brief Installs an arena backed by heap chunks of `chunkSize` bytes.
+   *
+   * No memory is reserved until the first frame is allocated.
+   */
+  explicit FrameArena(std::size_t chunkSize = DEFAULT_CHUNK_SIZE) noexcept
+      : _chunkSize(_align(chunkSize)), _previous(_active())
+  {
+    _active() = this;
+  }
+
+  /**
+   * @brief Installs an arena that first fills the caller-owned `buffer`.
+   *
+   * Once `buffer` is exhausted, frames spill into heap chunks.
+   * @param buffer Storage aligned to `__STDCPP_DEFAULT_NEW_ALIGNMENT__`.
+   * @param size Size of `buffer` in bytes.
+   */
+  FrameArena(void* buffer, std::size_t size) noexcept
+      : _cursor(static_cast<std::byte*>(buffer)),
+        _end(static_cast<std::byte*>(buffer) + size),
+        _chunkSize(DEFAULT_CHUNK_SIZE), _previous(_active())
+  {
+    _active() = this;
+  }
+
+  FrameArena(const FrameArena&) = delete;
+  FrameArena(FrameArena&&) = delete;
+  auto operator=(const FrameArena&) -> FrameArena& = delete;
+  auto operator=(FrameArena&&) -> FrameArena& = delete;
+
+  /// @brief Uninstalls the arena and releases all of its memory at once.
+  ~FrameArena() noexcept
+  {
+    assert(_active() == this && "FrameArena scopes must be strictly nested");
+    _active() = _previous;
+
+    while (_chunks)
+    {
+      Chunk* next = _chunks->next;
+      ::operator delete(_chunks, sizeof(Chunk) + _chunks->size);
+      _chunks = next;
+    }
+  }
+
+  /// @brief Returns the innermost arena installed on the calling thread.
+  [[nodiscard]]
+  static auto active() noexcept -> FrameArena*
+  {
+    return _active();
+  }
+
+  /// @brief Bump-allocates `size` bytes aligned to the default new alignment.
+  [[nodiscard]]
+  auto allocate(std::size_t size) -> void*
+  {
+    const std::size_t aligned = _align(size);
+    if (static_cast<std::size_t>(_end - _cursor) < aligned)
+      _grow(aligned);
+
+    void* result = _cursor;
+    _cursor += aligned;
+    _bytesAllocated += aligned;
+    return result;
+  }
+
+  /// @brief Total bytes handed out by this arena so far.
+  [[nodiscard]]
+  auto bytesAllocated() const noexcept -> std::size_t
+  {
+    return _bytesAllocated;
+  }
+};
+} // namespace ropic
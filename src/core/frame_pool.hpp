@@ -0,0 +1,441 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "frame_slab.hpp"
+
+/**
+ * @file frame_pool.hpp
+ * @brief Thread-local size-class free lists for Either coroutine frames.
+ *
+ * Frames that Clang's HALO does not elide (and every frame on GCC/MSVC) are
+ * allocated through the promise's operator new. With the pool enabled, freed
+ * frames are parked on a per-thread free list keyed by size class, so hot
+ * synchronous chains reuse the same few blocks instead of calling malloc on
+ * every call.
+ *
+ * Every pooled block remembers the pool that allocated it. A frame destroyed
+ * on another thread (e.g. an async coroutine completed by an I/O thread) is
+ * pushed onto its owner's lock-free remote-free queue, which the owner drains
+ * the next time a free list runs dry.
+ *
+ * With ROPIC_FRAME_HUGE_PAGES enabled, new blocks are carved from huge-page
+ * slabs (see frame_slab.hpp) instead of being allocated one by one.
+ */
+
+// ============================================================================
+// ROPIC_FRAME_POOL - Enable pooled coroutine frame allocation
+// ============================================================================
+// Defaults to 1. Define as 0 (or configure with -DROPIC_ENABLE_FRAME_POOL=OFF)
+// to fall back to the global operator new/delete for every frame.
+
+#ifndef ROPIC_FRAME_POOL
+#  define ROPIC_FRAME_POOL 1
+#endif
+
+namespace ropic::detail
+{
+/**
+ * @brief Per-thread cache of coroutine frame blocks, bucketed by size class.
+ *
+ * Each block is obtained individually from the global operator new, preceded
+ * by a header naming its owning pool. Blocks freed on the owning thread go
+ * straight to its free lists; blocks freed elsewhere travel back through the
+ * owner's remote-free queue. When a thread exits while some of its blocks are
+ * still alive, its queue is orphaned: those blocks go back to the global heap
+ * when freed, and the last one deletes the queue. Frames larger than
+ * MAX_POOLED_SIZE bypass the pool entirely.
+ *
+ * @tparam TAG Selects an independent set of per-thread pools, so that other
+ * block users (e.g. boxed errors) do not compete with frames.
+ *
+ * @warning Not thread-safe, except for remote frees; always access through
+ * local().
+ */
+template <typename TAG>
+class BasicFramePool
+{
+public:
+  /// Size class width; matches the default operator new alignment.
+  static constexpr std::size_t GRANULARITY = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+  /// Largest frame size served from the free lists.
+  static constexpr std::size_t MAX_POOLED_SIZE = 1024;
+
+  /// Maximum number of idle blocks kept per size class.
+  static constexpr std::size_t MAX_CACHED_PER_CLASS = 1024;
+
+private:
+  static constexpr std::size_t CLASS_COUNT = MAX_POOLED_SIZE / GRANULARITY;
+
+  struct FreeBlock
+  {
+    FreeBlock* next;
+  };
+
+  /// Blocks freed on other threads; outlives the pool while blocks are out.
+  struct RemoteQueue
+  {
+    std::atomic<FreeBlock*> head{nullptr};
+
+    /// One for the owning pool, plus one per block still out once orphaned.
+    std::atomic<std::size_t> references{1};
+
+#if ROPIC_FRAME_HUGE_PAGES
+    /// Slabs of an orphaned pool; released with the last outstanding block.
+    FrameSlab* slabs = nullptr;
+
+    RemoteQueue() = default;
+    RemoteQueue(const RemoteQueue&) = delete;
+    RemoteQueue(RemoteQueue&&) = delete;
+    auto operator=(const RemoteQueue&) -> RemoteQueue& = delete;
+    auto operator=(RemoteQueue&&) -> RemoteQueue& = delete;
+    ~RemoteQueue() { FrameSlab::releaseAll(slabs); }
+#endif
+  };
+
+  /// Written once, when the block is obtained from the global heap.
+  struct alignas(GRANULARITY) BlockHeader
+  {
+    RemoteQueue* owner;
+    std::uint32_t sizeClass;
+    bool inSlab;
+  };
+
+  std::array<FreeBlock*, CLASS_COUNT> _freeLists{};
+  std::array<std::size_t, CLASS_COUNT> _freeCounts{};
+  RemoteQueue* _remote;
+
+  /// Blocks allocated by this pool and not yet returned to it.
+  std::size_t _outstanding = 0;
+
+#if ROPIC_FRAME_HUGE_PAGES
+  FrameSlab* _slabs = nullptr;
+  std::byte* _slabCursor = nullptr;
+  std::byte* _slabEnd = nullptr;
+#endif
+
+  /// True while the calling thread's pool exists.
+  static auto _alive() noexcept -> bool&
+  {
+    thread_local bool alive = false;
+    return alive;
+  }
+
+  /// Marks the remote queue of a pool that no longer exists.
+  [[nodiscard]]
+  static auto _orphaned() noexcept -> FreeBlock*
+  {
+    return reinterpret_cast<FreeBlock*>(std::uintptr_t{1});
+  }
+
+  [[nodiscard]]
+  static constexpr auto _sizeClass(std::size_t size) noexcept -> std::size_t
+  {
+    return (size + GRANULARITY - 1) / GRANULARITY - 1;
+  }
+
+  [[nodiscard]]
+  static constexpr auto _blockSize(std::size_t sizeClass) noexcept
+      -> std::size_t
+  {
+    return (sizeClass + 1) * GRANULARITY;
+  }
+
+  [[nodiscard]]
+  static auto _header(void* block) noexcept -> BlockHeader*
+  {
+    return std::launder(static_cast<BlockHeader*>(block) - 1);
+  }
+
+  /// Slab blocks are only released together with their slab.
+  static void _deleteBlock(void* block) noexcept
+  {
+    BlockHeader* header = _header(block);
+    if (header->inSlab)
+      return;
+    ::operator delete(
+        header, sizeof(BlockHeader) + _blockSize(header->sizeClass));
+  }
+
+  static void _unreference(RemoteQueue* queue, std::size_t count) noexcept
+  {
+    if (queue->references.fetch_sub(count, std::memory_order_acq_rel) == count)
+      delete queue;
+  }
+
+  /// Hands a block back to the pool owning `queue` from any thread.
+  static void _pushRemote(RemoteQueue* queue, void* pointer) noexcept
+  {
+    auto* block = ::new (pointer) FreeBlock{nullptr};
+    FreeBlock* head = queue->head.load(std::memory_order_relaxed);
+    do
+    {
+      if (head == _orphaned())
+      {
+        _deleteBlock(block);
+        _unreference(queue, 1);
+        return;
+      }
+      block->next = head;
+    } while (!queue->head.compare_exchange_weak(
+        head, block, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  /// Takes back a block allocated by this pool.
+  void _recycle(void* block, std::size_t sizeClass) noexcept
+  {
+    --_outstanding;
+    if (_freeCounts[sizeClass] >= MAX_CACHED_PER_CLASS
+        && !_header(block)->inSlab)
+    {
+      _deleteBlock(block);
+      return;
+    }
+    _freeLists[sizeClass] = ::new (block) FreeBlock{_freeLists[sizeClass]};
+    ++_freeCounts[sizeClass];
+  }
+
+  /// Moves every block freed on other threads onto the free lists.
+  void _drainRemote() noexcept
+  {
+    FreeBlock* block = _remote->head.exchange(nullptr, std::memory_order_acquire);
+    while (block)
+    {
+      FreeBlock* next = block->next;
+      _recycle(block, _header(block)->sizeClass);
+      block = next;
+    }
+  }
+
+  /// Obtains a fresh block of `sizeClass` owned by this pool.
+  [[nodiscard]]
+  auto _newBlock(std::size_t sizeClass) -> void*
+  {
+    const std::size_t bytes = sizeof(BlockHeader) + _blockSize(sizeClass);
+#if ROPIC_FRAME_HUGE_PAGES
+    if (static_cast<std::size_t>(_slabEnd - _slabCursor) < bytes)
+    {
+      _slabs = FrameSlab::reserve(_slabs);
+      _slabCursor = _slabs->begin();
+      _slabEnd = _slabs->end();
+    }
+    void* memory = _slabCursor;
+    _slabCursor += bytes;
+    constexpr bool IN_SLAB = true;
+#else
+    void* memory = ::operator new(bytes);
+    constexpr bool IN_SLAB = false;
+#endif
+    auto* header = ::new (memory) BlockHeader{
+        .owner = _remote,
+        .sizeClass = static_cast<std::uint32_t>(sizeClass),
+        .inSlab = IN_SLAB};
+    return header + 1;
+  }
+
+  BasicFramePool() : _remote(new RemoteQueue) { _alive() = true; }
+
+public:
+  BasicFramePool(const BasicFramePool&) = delete;
+  BasicFramePool(BasicFramePool&&) = delete;
+  auto operator=(const BasicFramePool&) -> BasicFramePool& = delete;
+  auto operator=(BasicFramePool&&) -> BasicFramePool& = delete;
+
+  /// @brief Returns all cached blocks to the global heap and orphans the
+  /// blocks that are still alive.
+  ~BasicFramePool() noexcept
+  {
+    release();
+    _alive() = false;
+#if ROPIC_FRAME_HUGE_PAGES
+    _remote->slabs = _slabs;
+#endif
+
+    // Blocks still out now belong to the queue: count them before other
+    // threads can observe the orphaned marker.
+    _remote->references.fetch_add(_outstanding, std::memory_order_relaxed);
+    FreeBlock* block =
+        _remote->head.exchange(_orphaned(), std::memory_order_acq_rel);
+    std::size_t returned = 0;
+    while (block)
+    {
+      FreeBlock* next = block->next;
+      _deleteBlock(block);
+      ++returned;
+      block = next;
+    }
+    _unreference(_remote, returned + 1);
+  }
+
+  /// @brief Returns the calling thread's pool.
+  [[nodiscard]]
+  static auto local() -> BasicFramePool&
+  {
+    thread_local BasicFramePool pool;
+    return pool;
+  }
+
+  /**
+   * @brief Allocates a frame block of at least `size` bytes.
+   * @throws std::bad_alloc if the global heap is exhausted.
+   */
+  [[nodiscard]]
+  auto allocate(std::size_t size) -> void*
+  {
+    if (size == 0 || size > MAX_POOLED_SIZE)
+      return ::operator new(size);
+
+    const std::size_t sizeClass = _sizeClass(size);
+    if (!_freeLists[sizeClass]
+        && _remote->head.load(std::memory_order_relaxed))
+      _drainRemote();
+
+    if (FreeBlock* block = _freeLists[sizeClass])
+    {
+      _freeLists[sizeClass] = block->next;
+      --_freeCounts[sizeClass];
+      ++_outstanding;
+      return block;
+    }
+
+    void* block = _newBlock(sizeClass);
+    ++_outstanding;
+    return block;
+  }
+
+  /**
+   * @brief Returns a block obtained from allocate() with the same `size`.
+   *
+   * Blocks of another thread's pool are queued for their owner. Blocks beyond
+   * MAX_CACHED_PER_CLASS go straight back to the global heap.
+   */
+  void deallocate(void* pointer, std::size_t size) noexcept
+  {
+    if (size == 0 || size > MAX_POOLED_SIZE)
+    {
+      ::operator delete(pointer, size);
+      return;
+    }
+
+    const BlockHeader* header = _header(pointer);
+    if (header->owner != _remote)
+    {
+      _pushRemote(header->owner, pointer);
+      return;
+    }
+    _recycle(pointer, header->sizeClass);
+  }
+
+  /// @brief Frees every cached block, including those freed on other
+  /// threads so far; live frames are unaffected.
+  ///
+  /// With huge-page slabs, memory is only returned once no block is out.
+  void release() noexcept
+  {
+    _drainRemote();
+#if ROPIC_FRAME_HUGE_PAGES
+    if (_outstanding != 0)
+      return;
+    _freeLists = {};
+    _freeCounts = {};
+    FrameSlab::releaseAll(_slabs);
+    _slabs = nullptr;
+    _slabCursor = nullptr;
+    _slabEnd = nullptr;
+#else
+    for (std::size_t sizeClass = 0; sizeClass < CLASS_COUNT; ++sizeClass)
+    {
+      while (FreeBlock* block = _freeLists[sizeClass])
+      {
+        _freeLists[sizeClass] = block->next;
+        _deleteBlock(block);
+      }
+      _freeCounts[sizeClass] = 0;
+    }
+#endif
+  }
+
+  /**
+   * @brief Caches idle blocks up front so first frames skip the global heap.
+   *
+   * Tops up every size class up to `maxSize` to `blocksPerClass` idle blocks
+   * (at most MAX_CACHED_PER_CLASS without huge-page slabs).
+   * @return Number of bytes newly reserved.
+   * @throws std::bad_alloc if the global heap is exhausted.
+   */
+  auto reserve(std::size_t blocksPerClass, std::size_t maxSize) -> std::size_t
+  {
+    if (maxSize == 0)
+      return 0;
+    const std::size_t lastClass =
+        _sizeClass(maxSize < MAX_POOLED_SIZE ? maxSize : MAX_POOLED_SIZE);
+#if !ROPIC_FRAME_HUGE_PAGES
+    if (blocksPerClass > MAX_CACHED_PER_CLASS)
+      blocksPerClass = MAX_CACHED_PER_CLASS;
+#endif
+
+    std::size_t reserved = 0;
+    for (std::size_t sizeClass = 0; sizeClass <= lastClass; ++sizeClass)
+    {
+      while (_freeCounts[sizeClass] < blocksPerClass)
+      {
+        void* block = _newBlock(sizeClass);
+        _freeLists[sizeClass] = ::new (block) FreeBlock{_freeLists[sizeClass]};
+        ++_freeCounts[sizeClass];
+        reserved += sizeof(BlockHeader) + _blockSize(sizeClass);
+      }
+    }
+    return reserved;
+  }
+
+  /// @brief Number of idle blocks currently cached by this pool.
+  [[nodiscard]]
+  auto cachedBlocks() const noexcept -> std::size_t
+  {
+    std::size_t total = 0;
+    for (std::size_t count : _freeCounts)
+      total += count;
+    return total;
+  }
+
+  /// @brief Allocates a frame through the calling thread's pool.
+  [[nodiscard]]
+  static auto allocateFrame(std::size_t size) -> void*
+  {
+    return local().allocate(size);
+  }
+
+  /// @brief Frees a frame from any thread.
+  ///
+  /// Threads whose pool does not exist yet, or has already been destroyed
+  /// during thread teardown, hand the frame straight to its owner.
+  static void deallocateFrame(void* pointer, std::size_t size) noexcept
+  {
+    if (_alive())
+    {
+      local().deallocate(pointer, size);
+      return;
+    }
+    if (size == 0 || size > MAX_POOLED_SIZE)
+    {
+      ::operator delete(pointer, size);
+      return;
+    }
+    _pushRemote(_header(pointer)->owner, pointer);
+  }
+};
+
+/// Tag of the coroutine frame pools.
+struct FramePoolTag;
+
+/// Per-thread pool of coroutine frames.
+using FramePool = BasicFramePool<FramePoolTag>;
+} // namespace ropic::detail
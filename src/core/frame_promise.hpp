@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "frame_allocator.hpp"
+#include "frame_stats.hpp"
+
+namespace ropic::detail
+{
+/**
+ * @brief Frame allocation shared by the promise types of the library.
+ *
+ * Places frames in the thread-local frame pool, or with the allocator passed
+ * as `(std::allocator_arg, allocator, ...)` leading coroutine parameters, and
+ * records them in the FrameCounters of `OWNER` when ROPIC_FRAME_STATS is set.
+ *
+ * @tparam OWNER The coroutine return type whose promise derives from it.
+ */
+template <typename OWNER>
+class FramePromise
+{
+#if ROPIC_FRAME_STATS
+  [[nodiscard]]
+  static auto _counters() noexcept -> FrameCounters&
+  {
+    return FrameCounters::of<OWNER>();
+  }
+#endif
+
+public:
+#if ROPIC_FRAME_STATS
+  FramePromise() noexcept { _counters().recordStart(); }
+#endif
+
+  /// @brief Allocates the coroutine frame from the thread-local frame pool
+  /// (or the global heap when ROPIC_FRAME_POOL is 0).
+  [[nodiscard]]
+  static auto operator new(std::size_t size) -> void*
+  {
+    void* frame = allocateFrame(size);
+#if ROPIC_FRAME_STATS
+    _counters().recordAllocation(size);
+#endif
+    return frame;
+  }
+
+  /**
+   * @brief Places the frame with the allocator passed as
+   * `(std::allocator_arg, allocator, ...)` leading coroutine parameters.
+   *
+   * @code
+   * Either<int, Error> parse(std::allocator_arg_t, Alloc alloc, Text text);
+   * @endcode
+   *
+   * @note GCC pairs operator new and delete by mangled name and reports
+   * `-Wmismatched-new-delete` at such coroutines, since a member template
+   * cannot match the sized operator delete below. The frame is still released
+   * through the allocator it came from; silence the warning around them.
+   */
+  template <typename ALLOC, typename... ARGS>
+  [[nodiscard]]
+  static auto operator new(
+      std::size_t size,
+      std::allocator_arg_t /*unused*/,
+      const ALLOC& allocator,
+      const ARGS&... /*unused*/) -> void*
+  {
+    void* frame = AllocatorFrame<ALLOC>::allocate(size, allocator);
+#if ROPIC_FRAME_STATS
+    _counters().recordAllocation(size);
+#endif
+    return frame;
+  }
+
+  /// @brief Member-function overload; skips the implicit object parameter.
+  template <typename THIS, typename ALLOC, typename... ARGS>
+  [[nodiscard]]
+  static auto operator new(
+      std::size_t size,
+      const THIS& /*unused*/,
+      std::allocator_arg_t /*unused*/,
+      const ALLOC& allocator,
+      const ARGS&... /*unused*/) -> void*
+  {
+    void* frame = AllocatorFrame<ALLOC>::allocate(size, allocator);
+#if ROPIC_FRAME_STATS
+    _counters().recordAllocation(size);
+#endif
+    return frame;
+  }
+
+  /// @brief Releases the coroutine frame to wherever it was allocated from.
+  static void operator delete(void* frame, std::size_t size) noexcept
+  {
+#if ROPIC_FRAME_STATS
+    _counters().recordFree(size);
+#endif
+    deallocateFrame(frame, size);
+  }
+};
+} // namespace ropic::detail
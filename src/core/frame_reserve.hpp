@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <cstddef>
+
+#include "frame_allocator.hpp"
+
+/**
+ * @file frame_reserve.hpp
+ * @brief Pre-warming of the per-thread frame allocators.
+ */
+
+namespace ropic
+{
+/// @brief What reserveFrames() set aside on the calling thread.
+struct FrameReservation
+{
+  /// Idle frame blocks added to the frame pool.
+  std::size_t blocks = 0;
+
+  /// Bytes newly reserved by the frame pool and the frame stack.
+  std::size_t bytes = 0;
+};
+
+/**
+ * @brief Reserves frame memory for the calling thread ahead of time.
+ *
+ * Call on every worker thread at startup: the first requests then reuse
+ * blocks that are already allocated and faulted in instead of paying for
+ * page faults and malloc arena growth. Fills the frame pool with
+ * `framesPerSizeClass` idle blocks in every size class that can hold a frame
+ * of up to `maxFrameSize` bytes, and commits the frame stack when enabled.
+ * Calling it again only tops up what has been used since.
+ *
+ * @code
+ * std::jthread worker{[] {
+ *     ropic::reserveFrames(64, 512);
+ *     serveRequests();
+ * }};
+ * @endcode
+ *
+ * @return What was reserved; empty when the pool and stack are disabled.
+ * @throws std::bad_alloc if the memory cannot be reserved.
+ */
+inline auto reserveFrames(
+    std::size_t framesPerSizeClass,
+    std::size_t maxFrameSize = detail::FramePool::MAX_POOLED_SIZE)
+    -> FrameReservation
+{
+  FrameReservation reservation;
+#if ROPIC_FRAME_POOL
+  auto& pool = detail::FramePool::local();
+  const std::size_t cachedBefore = pool.cachedBlocks();
+  reservation.bytes += pool.reserve(
+      framesPerSizeClass, detail::frameAllocationSize(maxFrameSize));
+  reservation.blocks = pool.cachedBlocks() - cachedBefore;
+#else
+  (void)framesPerSizeClass;
+  (void)maxFrameSize;
+#endif
+#if ROPIC_FRAME_STACK
+  reservation.bytes += detail::FrameStack::local().reserve();
+#endif
+  return reservation;
+}
+} // namespace ropic
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <atomic>
+#include <memory_resource>
+
+/**
+ * @file frame_resource.hpp
+ * @brief std::pmr backend for Either coroutine frame allocation.
+ *
+ * Frames can be redirected to any `std::pmr::memory_resource`, so that frames
+ * and pmr-allocated payloads (e.g. `Either<std::pmr::vector<int>, Error>`)
+ * share one pool and one set of accounting. The effective resource of a thread
+ * is, in order of precedence:
+ * 1. the resource installed for the thread (setThreadFrameResource() or the
+ *    innermost FrameResourceScope);
+ * 2. the process-wide resource (setGlobalFrameResource());
+ * 3. none: frames use the built-in frame pool (or the global heap).
+ *
+ * An active FrameArena and an explicit `std::allocator_arg` allocator both
+ * take precedence over memory resources.
+ */
+
+namespace ropic
+{
+namespace detail
+{
+inline auto globalFrameResource() noexcept
+    -> std::atomic<std::pmr::memory_resource*>&
+{
+  static std::atomic<std::pmr::memory_resource*> resource{nullptr};
+  return resource;
+}
+
+inline auto threadFrameResource() noexcept -> std::pmr::memory_resource*&
+{
+  thread_local std::pmr::memory_resource* resource = nullptr;
+  return resource;
+}
+} // namespace detail
+
+/**
+ * @brief Routes frames of every thread without its own resource to
+ * `resource`.
+ * @param resource Must outlive every frame allocated from it; nullptr
+ * restores the built-in frame pool.
+ * @return The previous process-wide resource.
+ */
+inline auto setGlobalFrameResource(std::pmr::memory_resource* resource) noexcept
+    -> std::pmr::memory_resource*
+{
+  return detail::globalFrameResource().exchange(
+      resource, std::memory_order_acq_rel);
+}
+
+/**
+ * @brief Routes frames allocated on the calling thread to `resource`.
+ * @param resource Must outlive every frame allocated from it; nullptr falls
+ * back to the process-wide resource.
+ * @return The previous resource of the calling thread.
+ */
+inline auto setThreadFrameResource(std::pmr::memory_resource* resource) noexcept
+    -> std::pmr::memory_resource*
+{
+  auto& current = detail::threadFrameResource();
+  auto* previous = current;
+  current = resource;
+  return previous;
+}
+
+/// @brief Returns the resource frames of the calling thread are allocated
+/// from, or nullptr when the built-in frame pool is used.
+[[nodiscard]]
+inline auto currentFrameResource() noexcept -> std::pmr::memory_resource*
+{
+  if (auto* resource = detail::threadFrameResource())
+    return resource;
+  return detail::globalFrameResource().load(std::memory_order_acquire);
+}
+
+/**
+ * @brief RAII scope routing the calling thread's frames to a memory resource.
+ *
+ * @code
+ * std::pmr::unsynchronized_pool_resource pool;
+ * {
+ *     ropic::FrameResourceScope scope{&pool};
+ *     auto values = loadValues(); // Either<std::pmr::vector<int>, Error>
+ * }
+ * @endcode
+ */
+class FrameResourceScope
+{
+  std::pmr::memory_resource* _previous;
+
+public:
+  /// @brief Installs `resource` for the calling thread.
+  explicit FrameResourceScope(std::pmr::memory_resource* resource) noexcept
+      : _previous(setThreadFrameResource(resource))
+  {
+  }
+
+  FrameResourceScope(const FrameResourceScope&) = delete;
+  FrameResourceScope(FrameResourceScope&&) = delete;
+  auto operator=(const FrameResourceScope&) -> FrameResourceScope& = delete;
+  auto operator=(FrameResourceScope&&) -> FrameResourceScope& = delete;
+
+  /// @brief Restores the resource that was installed before this scope.
+  ~FrameResourceScope() noexcept { setThreadFrameResource(_previous); }
+};
+} // namespace ropic
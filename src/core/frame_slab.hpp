@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#if defined(__linux__)
+#  include <sys/mman.h>
+#endif
+
+/**
+ * @file frame_slab.hpp
+ * @brief Huge-page-backed slabs for the coroutine frame pool.
+ *
+ * Millions of live suspended frames scattered over 4 KiB pages make every
+ * resume a likely dTLB miss. With ROPIC_FRAME_HUGE_PAGES enabled, the frame
+ * pool carves its blocks from large slabs backed, in order of preference, by:
+ * 1. explicit huge pages (`MAP_HUGETLB`, needs `vm.nr_hugepages` reserved);
+ * 2. a huge-page-aligned mapping advised with `MADV_HUGEPAGE` (THP);
+ * 3. the global heap, when neither is available (non-Linux systems).
+ */
+
+// ============================================================================
+// ROPIC_FRAME_HUGE_PAGES - Back the frame pool with huge-page slabs
+// ============================================================================
+// Defaults to 0: pooled blocks are allocated one by one from the global heap.
+// Define as 1 (or configure with -DROPIC_ENABLE_FRAME_HUGE_PAGES=ON) to carve
+// them from slabs of ROPIC_FRAME_SLAB_SIZE bytes instead.
+
+#ifndef ROPIC_FRAME_HUGE_PAGES
+#  define ROPIC_FRAME_HUGE_PAGES 0
+#endif
+
+#ifndef ROPIC_FRAME_SLAB_SIZE
+#  define ROPIC_FRAME_SLAB_SIZE (std::size_t{2} * 1024 * 1024)
+#endif
+
+namespace ropic::detail
+{
+/// How the memory of a FrameSlab was obtained.
+enum class SlabBacking : std::uint8_t
+{
+  HUGETLB,
+  ADVISED,
+  HEAP,
+};
+
+/**
+ * @brief A slab of frame memory; its header sits at the start of the slab.
+ *
+ * Slabs form an intrusive list and are only released as a whole.
+ */
+class alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) FrameSlab
+{
+public:
+  /// Total size of a slab, header included.
+  static constexpr std::size_t SIZE = ROPIC_FRAME_SLAB_SIZE;
+
+  /// Huge page size the advised mappings are aligned to.
+  static constexpr std::size_t HUGE_PAGE_SIZE = std::size_t{2} * 1024 * 1024;
+
+private:
+  FrameSlab* _next;
+  SlabBacking _backing;
+
+  FrameSlab(FrameSlab* next, SlabBacking backing) noexcept
+      : _next(next), _backing(backing)
+  {
+  }
+
+#if defined(__linux__)
+  [[nodiscard]]
+  static auto _map(int flags) noexcept -> void*
+  {
+    void* memory = ::mmap(
+        nullptr,
+        SIZE,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | flags,
+        -1,
+        0);
+    return memory == MAP_FAILED ? nullptr : memory;
+  }
+
+  /// Maps SIZE bytes aligned to HUGE_PAGE_SIZE and advises THP for them.
+  [[nodiscard]]
+  static auto _mapAdvised() noexcept -> void*
+  {
+    void* raw = ::mmap(
+        nullptr,
+        SIZE + HUGE_PAGE_SIZE,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0);
+    if (raw == MAP_FAILED)
+      return nullptr;
+
+    auto* bytes = static_cast<std::byte*>(raw);
+    const auto address = reinterpret_cast<std::uintptr_t>(raw);
+    const std::size_t head =
+        ((address + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1)) - address;
+    if (head != 0)
+      ::munmap(bytes, head);
+    if (head != HUGE_PAGE_SIZE)
+      ::munmap(bytes + head + SIZE, HUGE_PAGE_SIZE - head);
+
+    // Advice only; the slab stays usable on 4 KiB pages if THP is disabled
+    ::madvise(bytes + head, SIZE, MADV_HUGEPAGE);
+    return bytes + head;
+  }
+#endif
+
+public:
+  FrameSlab(const FrameSlab&) = delete;
+  FrameSlab(FrameSlab&&) = delete;
+  auto operator=(const FrameSlab&) -> FrameSlab& = delete;
+  auto operator=(FrameSlab&&) -> FrameSlab& = delete;
+  ~FrameSlab() = default;
+
+  /**
+   * @brief Reserves a new slab and links it in front of `next`.
+   * @throws std::bad_alloc if every backing is exhausted.
+   */
+  [[nodiscard]]
+  static auto reserve(FrameSlab* next) -> FrameSlab*
+  {
+#if defined(__linux__)
+    if (void* memory = _map(MAP_HUGETLB))
+      return ::new (memory) FrameSlab{next, SlabBacking::HUGETLB};
+    if (void* memory = _mapAdvised())
+      return ::new (memory) FrameSlab{next, SlabBacking::ADVISED};
+#endif
+    void* memory = ::operator new(SIZE, std::align_val_t{alignof(FrameSlab)});
+    return ::new (memory) FrameSlab{next, SlabBacking::HEAP};
+  }
+
+  /// @brief Releases `slab` and every slab linked after it.
+  static void releaseAll(FrameSlab* slab) noexcept
+  {
+    while (slab)
+    {
+      FrameSlab* next = slab->_next;
+#if defined(__linux__)
+      if (slab->_backing != SlabBacking::HEAP)
+        ::munmap(slab, SIZE);
+      else
+#endif
+        ::operator delete(slab, SIZE, std::align_val_t{alignof(FrameSlab)});
+      slab = next;
+    }
+  }
+
+  /// @brief How this slab's memory was obtained.
+  [[nodiscard]]
+  auto backing() const noexcept -> SlabBacking
+  {
+    return _backing;
+  }
+
+  /// @brief First usable byte, right after the header.
+  [[nodiscard]]
+  auto begin() noexcept -> std::byte*
+  {
+    return reinterpret_cast<std::byte*>(this + 1);
+  }
+
+  /// @brief One past the last usable byte.
+  [[nodiscard]]
+  auto end() noexcept -> std::byte*
+  {
+    return reinterpret_cast<std::byte*>(this) + SIZE;
+  }
+};
+} // namespace ropic::detail
@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+/**
+ * @file frame_stack.hpp
+ * @brief Per-thread LIFO stack for synchronous Either coroutine frames.
+ *
+ * Either coroutines start eagerly and a synchronous co_await chain finishes
+ * in strict LIFO order, so its frames can be carved from a stack that only
+ * moves a pointer up and down. A frame that outlives its callers (because it
+ * suspended on a foreign awaitable) simply pins its slot: it is marked freed
+ * when it is eventually destroyed, on any thread, and the stack pointer skips
+ * over it once everything above it is gone. Frames that do not fit in the
+ * stack fall back to the frame pool (or the global heap).
+ */
+
+// ============================================================================
+// ROPIC_FRAME_STACK - Enable the synchronous frame stack
+// ============================================================================
+// Defaults to 0. Define as 1 (or configure with -DROPIC_ENABLE_FRAME_STACK=ON)
+// to allocate frames from a per-thread stack of ROPIC_FRAME_STACK_CAPACITY
+// bytes before falling back to the frame pool.
+
+#ifndef ROPIC_FRAME_STACK
+#  define ROPIC_FRAME_STACK 0
+#endif
+
+#ifndef ROPIC_FRAME_STACK_CAPACITY
+#  define ROPIC_FRAME_STACK_CAPACITY (std::size_t{256} * 1024)
+#endif
+
+namespace ropic::detail
+{
+/**
+ * @brief Bump-pointer stack of coroutine frames.
+ *
+ * Each frame is preceded by a header linking it to the frame below and
+ * holding a "freed" flag. Releasing the top frame pops it together with every
+ * already-freed frame beneath; releasing any other frame only sets its flag.
+ *
+ * @warning allocate() and release() are not thread-safe; frames may however
+ * be released from any thread through deallocate().
+ */
+class FrameStack
+{
+public:
+  /// Alignment of every frame; matches the default operator new alignment.
+  static constexpr std::size_t ALIGNMENT = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+  /// Capacity of the per-thread stack returned by local().
+  static constexpr std::size_t DEFAULT_CAPACITY = ROPIC_FRAME_STACK_CAPACITY;
+
+private:
+  struct alignas(ALIGNMENT) Header
+  {
+    Header* below;
+    std::atomic<bool> freed;
+  };
+
+  std::byte* _base = nullptr;
+  std::byte* _cursor = nullptr;
+  std::byte* _end = nullptr;
+  Header* _top = nullptr;
+  std::size_t _capacity;
+
+  /// True while the calling thread's stack exists.
+  static auto _alive() noexcept -> bool&
+  {
+    thread_local bool alive = false;
+    return alive;
+  }
+
+  [[nodiscard]]
+  static constexpr auto _align(std::size_t size) noexcept -> std::size_t
+  {
+    return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+  }
+
+  [[nodiscard]]
+  static auto _header(void* frame) noexcept -> Header*
+  {
+    return std::launder(reinterpret_cast<Header*>(frame) - 1);
+  }
+
+  [[nodiscard]]
+  auto _contains(const Header* header) const noexcept -> bool
+  {
+    const auto* address = reinterpret_cast<const std::byte*>(header);
+    return address >= _base && address < _end;
+  }
+
+  /// Pops every freed frame on top of the stack.
+  void _reclaim() noexcept
+  {
+    while (_top && _top->freed.load(std::memory_order_acquire))
+    {
+      _cursor = reinterpret_cast<std::byte*>(_top);
+      _top = _top->below;
+    }
+  }
+
+public:
+  /**
+   * @brief Creates a stack of `capacity` bytes.
+   *
+   * No memory is reserved until the first frame is allocated.
+   */
+  explicit FrameStack(std::size_t capacity = DEFAULT_CAPACITY) noexcept
+      : _capacity(_align(capacity))
+  {
+  }
+
+  FrameStack(const FrameStack&) = delete;
+  FrameStack(FrameStack&&) = delete;
+  auto operator=(const FrameStack&) -> FrameStack& = delete;
+  auto operator=(FrameStack&&) -> FrameStack& = delete;
+
+  /// @brief Releases the stack memory.
+  ///
+  /// If frames are still alive (e.g. suspended coroutines owned by another
+  /// thread), the memory is intentionally leaked so they stay valid.
+  ~FrameStack() noexcept
+  {
+    _reclaim();
+    if (!_top)
+      ::operator delete(_base, _capacity);
+  }
+
+  /// @brief Returns the calling thread's stack.
+  [[nodiscard]]
+  static auto local() noexcept -> FrameStack&
+  {
+    thread_local struct Local : FrameStack
+    {
+      Local() noexcept { _alive() = true; }
+      Local(const Local&) = delete;
+      Local(Local&&) = delete;
+      auto operator=(const Local&) -> Local& = delete;
+      auto operator=(Local&&) -> Local& = delete;
+      ~Local() noexcept { _alive() = false; }
+    } stack;
+    return stack;
+  }
+
+  /**
+   * @brief Commits the stack memory and touches every page of it.
+   * @return Number of bytes newly reserved (0 if already committed).
+   * @throws std::bad_alloc if the stack memory cannot be reserved.
+   */
+  auto reserve() -> std::size_t
+  {
+    if (_base)
+      return 0;
+    _base = static_cast<std::byte*>(::operator new(_capacity));
+    _cursor = _base;
+    _end = _base + _capacity;
+    constexpr std::size_t PAGE_SIZE = 4096;
+    for (std::byte* page = _base; page < _end; page += PAGE_SIZE)
+      *static_cast<volatile std::byte*>(page) = std::byte{0};
+    return _capacity;
+  }
+
+  /**
+   * @brief Pushes a frame of `size` bytes.
+   * @return The frame, or nullptr if it does not fit in the stack.
+   * @throws std::bad_alloc if the stack memory cannot be reserved.
+   */
+  [[nodiscard]]
+  auto allocate(std::size_t size) -> void*
+  {
+    if (!_base)
+      reserve();
+
+    _reclaim();
+    const std::size_t needed = sizeof(Header) + _align(size);
+    if (static_cast<std::size_t>(_end - _cursor) < needed)
+      return nullptr;
+
+    _top = ::new (_cursor) Header{.below = _top, .freed = false};
+    _cursor += needed;
+    return _top + 1;
+  }
+
+  /**
+   * @brief Releases a frame obtained from allocate() on the owning thread.
+   *
+   * Pops the frame if it is on top of the stack, otherwise marks it freed.
+   */
+  void release(void* frame) noexcept
+  {
+    Header* header = _header(frame);
+    if (header != _top)
+    {
+      header->freed.store(true, std::memory_order_relaxed);
+      return;
+    }
+    _cursor = reinterpret_cast<std::byte*>(header);
+    _top = header->below;
+    _reclaim();
+  }
+
+  /// @brief Bytes currently occupied by live or pinned frames.
+  [[nodiscard]]
+  auto bytesInUse() const noexcept -> std::size_t
+  {
+    return static_cast<std::size_t>(_cursor - _base);
+  }
+
+  /// @brief Allocates a frame from the calling thread's stack, or returns
+  /// nullptr when it is full.
+  [[nodiscard]]
+  static auto allocateFrame(std::size_t size) -> void*
+  {
+    return local().allocate(size);
+  }
+
+  /// @brief Releases a frame from any thread.
+  ///
+  /// Frames of another thread's stack (or of a stack already destroyed
+  /// during thread teardown) are only marked freed; their owner reclaims them.
+  static void deallocateFrame(void* frame) noexcept
+  {
+    if (_alive())
+    {
+      FrameStack& stack = local();
+      if (stack._contains(_header(frame)))
+      {
+        stack.release(frame);
+        return;
+      }
+    }
+    _header(frame)->freed.store(true, std::memory_order_release);
+  }
+};
+} // namespace ropic::detail
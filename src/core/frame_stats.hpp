@@ -0,0 +1,281 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file frame_stats.hpp
+ * @brief Optional coroutine frame allocation statistics.
+ *
+ * With ROPIC_FRAME_STATS enabled, every Either instantiation counts the
+ * coroutines it starts and the frames it allocates and frees. Coroutines that
+ * start without allocating a frame had their frame elided (HALO). Read the
+ * counters at runtime with ropic::stats().
+ */
+
+// ============================================================================
+// ROPIC_FRAME_STATS - Enable frame allocation statistics
+// ============================================================================
+// Defaults to 0: the counting hooks are compiled out and ropic::stats()
+// returns an empty snapshot. Define as 1 (or configure with
+// -DROPIC_ENABLE_FRAME_STATS=ON) to collect statistics.
+
+#ifndef ROPIC_FRAME_STATS
+#  define ROPIC_FRAME_STATS 0
+#endif
+
+namespace ropic
+{
+/// Number of frame-size histogram buckets (see FrameStats::sizeHistogram).
+inline constexpr std::size_t FRAME_SIZE_BUCKETS = 8;
+
+/**
+ * @brief Frame allocation counters of one Either instantiation (or totals).
+ *
+ * `sizeHistogram[i]` counts frames of at most `64 << i` bytes; the last bucket
+ * also counts every larger frame.
+ */
+struct FrameStats
+{
+  std::string_view type;
+  std::uint64_t coroutinesStarted = 0;
+  std::uint64_t framesAllocated = 0;
+  std::uint64_t framesFreed = 0;
+  std::uint64_t bytesAllocated = 0;
+  std::uint64_t liveBytes = 0;
+  std::uint64_t peakLiveBytes = 0;
+  std::array<std::uint64_t, FRAME_SIZE_BUCKETS> sizeHistogram{};
+
+  /// @brief Coroutines whose frame was elided by the compiler (HALO).
+  [[nodiscard]]
+  auto framesElided() const noexcept -> std::uint64_t
+  {
+    return coroutinesStarted > framesAllocated
+             ? coroutinesStarted - framesAllocated
+             : 0;
+  }
+};
+
+/// @brief Point-in-time copy of all frame statistics.
+struct StatsSnapshot
+{
+  /// Sum over all instantiations; `peakLiveBytes` is the process-wide peak.
+  FrameStats total;
+
+  /// One entry per Either instantiation that started a coroutine.
+  std::vector<FrameStats> perType;
+};
+
+namespace detail
+{
+/// @brief Extracts `T` from the signature of an instantiation of this
+/// function; falls back to the whole signature on unknown compilers.
+template <typename T>
+[[nodiscard]]
+constexpr auto typeName() noexcept -> std::string_view
+{
+  const std::string_view signature =
+      std::source_location::current().function_name();
+  const std::size_t begin = signature.find("T = ");
+  if (begin == std::string_view::npos)
+    return signature;
+  const std::size_t end = signature.find_first_of(";]", begin);
+  return signature.substr(begin + 4, end - begin - 4);
+}
+
+/// @brief Thread-safe counters of one Either instantiation.
+class FrameCounters
+{
+  using Counter = std::atomic<std::uint64_t>;
+
+  std::string_view _type;
+  Counter _coroutinesStarted{0};
+  Counter _framesAllocated{0};
+  Counter _framesFreed{0};
+  Counter _bytesAllocated{0};
+  Counter _liveBytes{0};
+  Counter _peakLiveBytes{0};
+  std::array<Counter, FRAME_SIZE_BUCKETS> _sizeHistogram{};
+  FrameCounters* _next = nullptr;
+
+  static auto _head() noexcept -> std::atomic<FrameCounters*>&
+  {
+    static std::atomic<FrameCounters*> head{nullptr};
+    return head;
+  }
+
+  static auto _totalLiveBytes() noexcept -> Counter&
+  {
+    static Counter live{0};
+    return live;
+  }
+
+  static auto _totalPeakLiveBytes() noexcept -> Counter&
+  {
+    static Counter peak{0};
+    return peak;
+  }
+
+  static void _raise(Counter& peak, std::uint64_t value) noexcept
+  {
+    std::uint64_t current = peak.load(std::memory_order_relaxed);
+    while (current < value
+           && !peak.compare_exchange_weak(
+               current, value, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  [[nodiscard]]
+  static constexpr auto _bucket(std::size_t size) noexcept -> std::size_t
+  {
+    std::size_t bucket = 0;
+    for (std::size_t limit = 64; size > limit && bucket + 1 < FRAME_SIZE_BUCKETS;
+         limit <<= 1)
+      ++bucket;
+    return bucket;
+  }
+
+  explicit FrameCounters(std::string_view type) noexcept : _type(type)
+  {
+    auto& head = _head();
+    _next = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(
+        _next, this, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+  }
+
+public:
+  FrameCounters(const FrameCounters&) = delete;
+  FrameCounters(FrameCounters&&) = delete;
+  auto operator=(const FrameCounters&) -> FrameCounters& = delete;
+  auto operator=(FrameCounters&&) -> FrameCounters& = delete;
+  ~FrameCounters() = default;
+
+  /// @brief Returns the counters of instantiation `T`, registering them on
+  /// first use.
+  template <typename T>
+  [[nodiscard]]
+  static auto of() noexcept -> FrameCounters&
+  {
+    static FrameCounters counters{typeName<T>()};
+    return counters;
+  }
+
+  void recordStart() noexcept
+  {
+    _coroutinesStarted.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void recordAllocation(std::size_t size) noexcept
+  {
+    _framesAllocated.fetch_add(1, std::memory_order_relaxed);
+    _bytesAllocated.fetch_add(size, std::memory_order_relaxed);
+    _sizeHistogram[_bucket(size)].fetch_add(1, std::memory_order_relaxed);
+    _raise(
+        _peakLiveBytes,
+        _liveBytes.fetch_add(size, std::memory_order_relaxed) + size);
+    _raise(
+        _totalPeakLiveBytes(),
+        _totalLiveBytes().fetch_add(size, std::memory_order_relaxed) + size);
+  }
+
+  void recordFree(std::size_t size) noexcept
+  {
+    _framesFreed.fetch_add(1, std::memory_order_relaxed);
+    _liveBytes.fetch_sub(size, std::memory_order_relaxed);
+    _totalLiveBytes().fetch_sub(size, std::memory_order_relaxed);
+  }
+
+  /// @brief Copies the counters of every registered instantiation.
+  [[nodiscard]]
+  static auto snapshot() -> StatsSnapshot
+  {
+    StatsSnapshot result;
+    result.total.type = "total";
+    for (auto* counters = _head().load(std::memory_order_acquire); counters;
+         counters = counters->_next)
+    {
+      FrameStats stats{
+          .type = counters->_type,
+          .coroutinesStarted = counters->_coroutinesStarted.load(),
+          .framesAllocated = counters->_framesAllocated.load(),
+          .framesFreed = counters->_framesFreed.load(),
+          .bytesAllocated = counters->_bytesAllocated.load(),
+          .liveBytes = counters->_liveBytes.load(),
+          .peakLiveBytes = counters->_peakLiveBytes.load(),
+      };
+      for (std::size_t i = 0; i < FRAME_SIZE_BUCKETS; ++i)
+      {
+        stats.sizeHistogram[i] = counters->_sizeHistogram[i].load();
+        result.total.sizeHistogram[i] += stats.sizeHistogram[i];
+      }
+      result.total.coroutinesStarted += stats.coroutinesStarted;
+      result.total.framesAllocated += stats.framesAllocated;
+      result.total.framesFreed += stats.framesFreed;
+      result.total.bytesAllocated += stats.bytesAllocated;
+      result.perType.push_back(stats);
+    }
+    result.total.liveBytes = _totalLiveBytes().load();
+    result.total.peakLiveBytes = _totalPeakLiveBytes().load();
+    return result;
+  }
+
+  /// @brief Zeroes every counter; peaks restart from the current live bytes.
+  static void reset() noexcept
+  {
+    for (auto* counters = _head().load(std::memory_order_acquire); counters;
+         counters = counters->_next)
+    {
+      counters->_coroutinesStarted = 0;
+      counters->_framesAllocated = 0;
+      counters->_framesFreed = 0;
+      counters->_bytesAllocated = 0;
+      counters->_peakLiveBytes = counters->_liveBytes.load();
+      for (auto& bucket : counters->_sizeHistogram)
+        bucket = 0;
+    }
+    _totalPeakLiveBytes() = _totalLiveBytes().load();
+  }
+};
+} // namespace detail
+
+/**
+ * @brief Returns a snapshot of the frame allocation statistics.
+ *
+ * Always empty when ROPIC_FRAME_STATS is 0.
+ *
+ * @code
+ * for (const auto& entry : ropic::stats().perType)
+ *     std::cout << entry.type << ": " << entry.framesElided() << " elided\n";
+ * @endcode
+ */
+[[nodiscard]]
+inline auto stats() -> StatsSnapshot
+{
+#if ROPIC_FRAME_STATS
+  return detail::FrameCounters::snapshot();
+#else
+  StatsSnapshot result;
+  result.total.type = "total";
+  return result;
+#endif
+}
+
+/// @brief Zeroes all frame allocation statistics (no-op when compiled out).
+inline void resetStats() noexcept
+{
+#if ROPIC_FRAME_STATS
+  detail::FrameCounters::reset();
+#endif
+}
+} // namespace ropic
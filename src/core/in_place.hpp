@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <tuple>
+#include <utility>
+
+namespace ropic
+{
+/**
+ * @brief Constructor arguments for the data of an Either, captured by
+ * reference by ropic::in_place().
+ *
+ * Only meant to be passed straight to `co_return`.
+ */
+template <typename... ARGS>
+struct InPlaceData
+{
+  std::tuple<ARGS&&...> args;
+};
+
+/// @brief Constructor arguments for the error of an Either, captured by
+/// reference by ropic::in_place_error().
+template <typename... ARGS>
+struct InPlaceError
+{
+  std::tuple<ARGS&&...> args;
+};
+
+/**
+ * @brief Constructs the data of the returning Either in place from `args`.
+ *
+ * @code
+ * Either<LargeStruct, Error> load(std::string name) {
+ *     co_return ropic::in_place(std::array<int, 100>{}, std::move(name));
+ * }
+ * @endcode
+ *
+ * @warning The arguments are captured by reference; use the result only as
+ * the operand of `co_return`.
+ */
+template <typename... ARGS>
+[[nodiscard]]
+constexpr auto in_place(ARGS&&... args) noexcept -> InPlaceData<ARGS...>
+{
+  return InPlaceData<ARGS...>{
+      std::forward_as_tuple(std::forward<ARGS>(args)...)};
+}
+
+/// @brief Constructs the error of the returning Either in place from `args`.
+/// @warning The arguments are captured by reference; use the result only as
+/// the operand of `co_return`.
+template <typename... ARGS>
+[[nodiscard]]
+constexpr auto in_place_error(ARGS&&... args) noexcept -> InPlaceError<ARGS...>
+{
+  return InPlaceError<ARGS...>{
+      std::forward_as_tuple(std::forward<ARGS>(args)...)};
+}
+} // namespace ropic
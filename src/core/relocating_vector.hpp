@@ -0,0 +1,252 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "relocation.hpp"
+
+namespace ropic
+{
+/**
+ * @brief Growable array that moves its elements with uninitialized_relocate.
+ *
+ * Meant for batches of results: when the buffer grows, trivially relocatable
+ * elements (such as Either with trivially relocatable payloads) are copied
+ * with one memcpy instead of a move constructor and destructor call each.
+ * Offers the subset of the std::vector interface needed to fill, scan and
+ * drain such a batch.
+ *
+ * @code
+ * ropic::RelocatingVector<Either<std::unique_ptr<Row>, ErrorCode>> rows;
+ * for (const auto& key : keys)
+ *     rows.push_back(load(key));
+ * @endcode
+ */
+template <typename T>
+class RelocatingVector
+{
+  T* _data = nullptr;
+  std::size_t _size = 0;
+  std::size_t _capacity = 0;
+
+  /// Relocating out of the old buffer cannot fail halfway.
+  static constexpr bool NOTHROW_RELOCATE =
+      noexcept(uninitialized_relocate<T>(nullptr, nullptr, nullptr));
+
+  [[nodiscard]]
+  static auto _allocate(std::size_t capacity) -> T*
+  {
+    return std::allocator<T>{}.allocate(capacity);
+  }
+
+  static void _deallocate(T* data, std::size_t capacity) noexcept
+  {
+    if (data)
+      std::allocator<T>{}.deallocate(data, capacity);
+  }
+
+  [[nodiscard]]
+  auto _grownCapacity() const noexcept -> std::size_t
+  {
+    return _capacity == 0 ? 4 : _capacity * 2;
+  }
+
+  /// Moves the elements into a new buffer of `capacity` elements, after
+  /// constructing the new last element there from `args`.
+  template <typename... ARGS>
+  auto _growAndEmplace(std::size_t capacity, ARGS&&... args) -> T&
+  {
+    T* data = _allocate(capacity);
+    T* added = data + _size;
+    try
+    {
+      std::construct_at(added, std::forward<ARGS>(args)...);
+    }
+    catch (...)
+    {
+      _deallocate(data, capacity);
+      throw;
+    }
+    if constexpr (NOTHROW_RELOCATE)
+    {
+      uninitialized_relocate(_data, _data + _size, data);
+    }
+    else
+    {
+      try
+      {
+        uninitialized_relocate(_data, _data + _size, data);
+      }
+      catch (...)
+      {
+        std::destroy_at(added);
+        _deallocate(data, capacity);
+        throw;
+      }
+    }
+    _deallocate(_data, _capacity);
+    _data = data;
+    _capacity = capacity;
+    ++_size;
+    return *added;
+  }
+
+public:
+  RelocatingVector() noexcept = default;
+
+  RelocatingVector(RelocatingVector&& other) noexcept
+      : _data(std::exchange(other._data, nullptr)),
+        _size(std::exchange(other._size, 0)),
+        _capacity(std::exchange(other._capacity, 0))
+  {
+  }
+
+  auto operator=(RelocatingVector&& other) noexcept -> RelocatingVector&
+  {
+    if (this != &other)
+    {
+      clear();
+      _deallocate(_data, _capacity);
+      _data = std::exchange(other._data, nullptr);
+      _size = std::exchange(other._size, 0);
+      _capacity = std::exchange(other._capacity, 0);
+    }
+    return *this;
+  }
+
+  RelocatingVector(const RelocatingVector&) = delete;
+  auto operator=(const RelocatingVector&) -> RelocatingVector& = delete;
+
+  ~RelocatingVector()
+  {
+    clear();
+    _deallocate(_data, _capacity);
+  }
+
+  /// @brief Grows the buffer to hold at least `capacity` elements.
+  void reserve(std::size_t capacity)
+  {
+    if (capacity <= _capacity)
+      return;
+    T* data = _allocate(capacity);
+    if constexpr (NOTHROW_RELOCATE)
+    {
+      uninitialized_relocate(_data, _data + _size, data);
+    }
+    else
+    {
+      try
+      {
+        uninitialized_relocate(_data, _data + _size, data);
+      }
+      catch (...)
+      {
+        _deallocate(data, capacity);
+        throw;
+      }
+    }
+    _deallocate(_data, _capacity);
+    _data = data;
+    _capacity = capacity;
+  }
+
+  // NOLINTBEGIN(readability-identifier-naming)
+  /// @brief Constructs an element at the end from `args`.
+  template <typename... ARGS>
+  auto emplace_back(ARGS&&... args) -> T&
+  {
+    if (_size == _capacity)
+      return _growAndEmplace(_grownCapacity(), std::forward<ARGS>(args)...);
+    T* added = std::construct_at(_data + _size, std::forward<ARGS>(args)...);
+    ++_size;
+    return *added;
+  }
+
+  /// @brief Moves `value` to the end.
+  void push_back(T&& value) { emplace_back(std::move(value)); }
+
+  /// @brief Destroys the last element.
+  void pop_back() noexcept
+  {
+    assert(_size != 0 && "RelocatingVector is empty");
+    std::destroy_at(_data + --_size);
+  }
+  // NOLINTEND(readability-identifier-naming)
+
+  /// @brief Destroys all elements and keeps the buffer.
+  void clear() noexcept
+  {
+    std::destroy(_data, _data + _size);
+    _size = 0;
+  }
+
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t
+  {
+    return _size;
+  }
+
+  [[nodiscard]]
+  auto capacity() const noexcept -> std::size_t
+  {
+    return _capacity;
+  }
+
+  [[nodiscard]]
+  auto empty() const noexcept -> bool
+  {
+    return _size == 0;
+  }
+
+  [[nodiscard]]
+  auto data() noexcept -> T*
+  {
+    return _data;
+  }
+
+  [[nodiscard]]
+  auto operator[](std::size_t index) noexcept -> T&
+  {
+    assert(index < _size && "RelocatingVector index out of range");
+    return _data[index];
+  }
+
+  [[nodiscard]]
+  auto operator[](std::size_t index) const noexcept -> const T&
+  {
+    assert(index < _size && "RelocatingVector index out of range");
+    return _data[index];
+  }
+
+  [[nodiscard]]
+  auto begin() noexcept -> T*
+  {
+    return _data;
+  }
+
+  [[nodiscard]]
+  auto end() noexcept -> T*
+  {
+    return _data + _size;
+  }
+
+  [[nodiscard]]
+  auto begin() const noexcept -> const T*
+  {
+    return _data;
+  }
+
+  [[nodiscard]]
+  auto end() const noexcept -> const T*
+  {
+    return _data + _size;
+  }
+};
+} // namespace ropic
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+/**
+ * @file relocation.hpp
+ * @brief Trivial relocation: moving objects to new storage with memcpy.
+ *
+ * Relocating an object means move-constructing it elsewhere and destroying
+ * the source. For most types, including unique_ptr-like owners and ropic's
+ * own result types, copying the bytes and forgetting the source has the same
+ * effect, much cheaper; containers growing their buffer rely on it.
+ */
+
+namespace ropic
+{
+/**
+ * @brief Opt-in declaration that a `T` can be relocated by copying its bytes.
+ *
+ * True for trivially copyable types. Specialize it for types that hold no
+ * pointer into themselves and are not registered anywhere by address:
+ *
+ * @code
+ * template <>
+ * struct ropic::is_trivially_relocatable<Error> : std::true_type {};
+ * @endcode
+ *
+ * @note libstdc++'s std::string points into itself and is not trivially
+ * relocatable.
+ */
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T>
+{
+};
+
+/// @brief Shorthand for `is_trivially_relocatable<T>::value`.
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+/// The default deleter is empty and the pointer has no address identity.
+template <typename T>
+struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type
+{
+};
+
+namespace detail
+{
+/**
+ * @brief Hook for types that relocate by copying their bytes, as long as
+ * they are told their new address afterwards.
+ *
+ * Specializations set `ENABLED` and provide
+ * `static void apply(T& relocated) noexcept`.
+ */
+template <typename T>
+struct RebindAfterRelocation
+{
+  static constexpr bool ENABLED = false;
+};
+} // namespace detail
+
+/**
+ * @brief Relocates `[first, last)` into the uninitialized storage at `dest`.
+ *
+ * Copies the bytes when `T` is trivially relocatable (or only needs to be
+ * rebound to its new address), and move-constructs then destroys each element
+ * otherwise. Afterwards the source range is uninitialized storage.
+ *
+ * @pre `dest` does not overlap `[first, last)`.
+ * @return The end of the relocated range.
+ */
+template <typename T>
+// NOLINTNEXTLINE(readability-identifier-naming)
+auto uninitialized_relocate(T* first, T* last, T* dest) noexcept(
+    is_trivially_relocatable_v<T>
+    || detail::RebindAfterRelocation<T>::ENABLED
+    || std::is_nothrow_move_constructible_v<T>) -> T*
+{
+  const auto count = static_cast<std::size_t>(last - first);
+  if constexpr (
+      is_trivially_relocatable_v<T>
+      || detail::RebindAfterRelocation<T>::ENABLED)
+  {
+    if (count != 0)
+    {
+      std::memcpy(
+          static_cast<void*>(dest),
+          static_cast<const void*>(first),
+          count * sizeof(T));
+    }
+    if constexpr (!is_trivially_relocatable_v<T>)
+    {
+      for (std::size_t i = 0; i != count; ++i)
+        detail::RebindAfterRelocation<T>::apply(dest[i]);
+    }
+    return dest + count;
+  }
+  else
+  {
+    T* end = std::uninitialized_move(first, last, dest);
+    std::destroy(first, last);
+    return end;
+  }
+}
+} // namespace ropic
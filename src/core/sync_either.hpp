@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <cassert>
+#include <coroutine>
+#include <type_traits>
+#include <utility>
+
+#include "attributes.hpp"
+#include "borrower.hpp"
+#include "either_concept.hpp"
+#include "either_impl.hpp"
+#include "either_storage.hpp"
+#include "error_box.hpp"
+#include "relocation.hpp"
+#include "void.hpp"
+
+namespace ropic::detail
+{
+/**
+ * @class SyncEitherImpl
+ * @brief Either whose coroutine is guaranteed to finish before returning.
+ *
+ * @tparam DATA The success value type (must satisfy detail::plain_value_type)
+ * @tparam ERROR The error type (must satisfy detail::plain_value_type). Must
+ * differ from DATA.
+ *
+ * Its promise only accepts EitherImpl, ValueEither and SyncEitherImpl
+ * operands with the same ERROR in `co_await`; any other awaitable is a
+ * compile-time error. The coroutine therefore never suspends, so:
+ * - a SyncEitherImpl always holds data or an error once returned; there is
+ *   no empty state and done() is always true;
+ * - it does not own the coroutine handle and its moves never rebind the
+ *   promise. The promise points at the result only while the body runs,
+ *   inside the call that returns it.
+ *
+ * A moved-from SyncEitherImpl, or one whose payload was taken, keeps a
+ * moved-from value of the same alternative.
+ *
+ * @warning The `data()` and `error()` methods return Borrower pointers that
+ * become dangling after the SyncEitherImpl object is destroyed or moved.
+ */
+template <typename DATA, typename ERROR>
+class ROPIC_CORO_AWAIT_ELIDABLE SyncEitherImpl
+{
+  static_assert(
+      either_concept<DATA, ERROR>,
+      "`DATA` and `ERROR` must not be identical and not be reference, const, "
+      "void or monostate types");
+  // ==========================================
+  // PRIVATE NESTED TYPES
+  // ==========================================
+  class Promise;
+
+  /// Awaiter for EitherImpl, ValueEither or SyncEitherImpl composition.
+  /// Propagates errors, extracts values.
+  template <typename OTHER, bool IS_LVALUE, typename SOURCE>
+  class PropagatingAwaiter;
+
+  using Handle = std::coroutine_handle<Promise>;
+
+  /// Null handle standing for the result while the coroutine body runs.
+  using Unset = std::coroutine_handle<>;
+
+  /// ERROR itself, or its ErrorBox when ropic::box_error opts it in.
+  using Stored = StoredError<ERROR>;
+
+  template <typename OTHER_DATA, typename OTHER_ERROR>
+  friend class EitherImpl;
+
+  template <typename OTHER_DATA, typename OTHER_ERROR>
+  friend class AsyncEitherImpl;
+
+  template <typename OTHER_DATA, typename OTHER_ERROR>
+  friend class SyncEitherImpl;
+
+  // ==========================================
+  // PRIVATE VARIABLES & FUNCTIONS
+  // ==========================================
+  /// Data or error; Unset only until the coroutine body returns.
+  EitherStorageFor<Unset, DATA, Stored> _result;
+
+  /// @brief Constructs the result of a coroutine about to run (coroutine
+  /// mode); `promise` writes into it.
+  explicit SyncEitherImpl(Promise& promise) noexcept
+      : _result(std::in_place_type<Unset>)
+  {
+    promise.setEither(this);
+  }
+
+  /// @brief Constructs the error in place from `args`.
+  template <typename... ARGS>
+  void _setError(ARGS&&... args) noexcept(
+      std::is_nothrow_constructible_v<ERROR, ARGS&&...> && !box_error_v<ERROR>)
+  {
+    if constexpr (box_error_v<ERROR>)
+    {
+      _result.template emplace<Stored>(
+          std::in_place, std::forward<ARGS>(args)...);
+    }
+    else
+    {
+      _result.template emplace<ERROR>(std::forward<ARGS>(args)...);
+    }
+  }
+
+  /// @brief Takes over the stored error (or its box) of `other` as is.
+  /// @tparam SOURCE An EitherImpl or SyncEitherImpl with the same ERROR.
+  template <typename SOURCE>
+  void _takeError(SOURCE& other) noexcept(
+      std::is_nothrow_move_constructible_v<Stored>)
+  {
+    Stored* stored = other._storedError();
+    assert(stored && "`other` must hold an error");
+    _result.template emplace<Stored>(std::move(*stored));
+  }
+
+  /// @brief Constructs the data in place from `args`.
+  template <typename... ARGS>
+  void _setData(ARGS&&... args)
+      noexcept(std::is_nothrow_constructible_v<DATA, ARGS&&...>)
+  {
+    _result.template emplace<DATA>(std::forward<ARGS>(args)...);
+  }
+
+  /// @brief Returns the stored error (or its box), or nullptr.
+  [[nodiscard]]
+  constexpr auto _storedError() noexcept -> Stored*
+  {
+    return _result.template getIf<Stored>();
+  }
+
+public:
+  using promise_type = Promise;
+
+  // ==========================================
+  // CONSTRUCTORS, DESTRUCTOR, OPERATORS
+  // ==========================================
+
+  /// @brief Constructs a SyncEitherImpl containing an error.
+  constexpr SyncEitherImpl(ERROR e)
+      noexcept(std::is_nothrow_constructible_v<Stored, ERROR&&>)
+      : _result(std::in_place_type<Stored>, std::move(e))
+  {
+  }
+
+  /// @brief Constructs a SyncEitherImpl containing data.
+  constexpr SyncEitherImpl(DATA d)
+      noexcept(std::is_nothrow_move_constructible_v<DATA>)
+      : _result(std::in_place_type<DATA>, std::move(d))
+  {
+  }
+
+  /// @brief Copy disabled; use move semantics.
+  SyncEitherImpl(const SyncEitherImpl&) = delete;
+
+  /// @brief Copy disabled; use move semantics.
+  auto operator=(const SyncEitherImpl&) -> SyncEitherImpl& = delete;
+
+  /// @brief Moves the result; nothing refers back to `other`.
+  constexpr SyncEitherImpl(SyncEitherImpl&&) noexcept(
+      std::is_nothrow_move_constructible_v<DATA>
+      && std::is_nothrow_move_constructible_v<Stored>) = default;
+
+  /// @brief Replaces the result with the one of `other`.
+  constexpr auto operator=(SyncEitherImpl&&) noexcept(
+      std::is_nothrow_move_constructible_v<DATA>
+      && std::is_nothrow_move_constructible_v<Stored>)
+      -> SyncEitherImpl& = default;
+
+  constexpr ~SyncEitherImpl() = default;
+
+  // ==========================================
+  // ACCESSORS
+  // ==========================================
+
+  /**
+   * @brief Returns optional reference to error if present, empty Borrower
+   * otherwise.
+   * @warning Returned Borrower becomes dangling after SyncEitherImpl is
+   * destroyed or moved.
+   */
+  [[nodiscard]]
+  constexpr auto error() noexcept -> Borrower<ERROR>
+  {
+    return Borrower<ERROR>{unboxError<ERROR>(_result.template getIf<Stored>())};
+  }
+
+  /// @copydoc error()
+  [[nodiscard]]
+  constexpr auto error() const noexcept -> Borrower<const ERROR>
+  {
+    return Borrower<const ERROR>{
+        unboxError<ERROR>(_result.template getIf<Stored>())};
+  }
+
+  /**
+   * @brief Returns optional reference to data if present, empty Borrower
+   * otherwise.
+   * @warning Returned Borrower becomes dangling after SyncEitherImpl is
+   * destroyed or moved.
+   */
+  [[nodiscard]]
+  constexpr auto data() noexcept -> Borrower<DATA>
+  {
+    return Borrower<DATA>{_result.template getIf<DATA>()};
+  }
+
+  /// @copydoc data()
+  [[nodiscard]]
+  constexpr auto data() const noexcept -> Borrower<const DATA>
+  {
+    return Borrower<const DATA>{_result.template getIf<DATA>()};
+  }
+
+  /**
+   * @brief Moves the data out; a moved-from DATA stays behind.
+   * @pre data() is not empty.
+   */
+  [[nodiscard]]
+  constexpr auto takeData() &&
+      noexcept(std::is_nothrow_move_constructible_v<DATA>) -> DATA
+  {
+    DATA* data = _result.template getIf<DATA>();
+    assert(data && "SyncEitherImpl must contain data");
+    return std::move(*data);
+  }
+
+  /**
+   * @brief Moves the error out; a moved-from ERROR stays behind.
+   * @pre error() is not empty.
+   */
+  [[nodiscard]]
+  constexpr auto takeError() &&
+      noexcept(std::is_nothrow_move_constructible_v<ERROR>) -> ERROR
+  {
+    ERROR* error = unboxError<ERROR>(_result.template getIf<Stored>());
+    assert(error && "SyncEitherImpl must contain an error");
+    return std::move(*error);
+  }
+
+  /// @brief Always true: a SyncEitherImpl holds data or an error.
+  [[nodiscard]]
+  constexpr auto done() const noexcept -> bool
+  {
+    assert(!_result.template holds<Unset>() && "SyncEitherImpl has no result");
+    return true;
+  }
+};
+} // namespace ropic::detail
+
+namespace ropic
+{
+/// Nothing refers back to a SyncEitherImpl, so it relocates like its payloads.
+template <typename DATA, typename ERROR>
+struct is_trivially_relocatable<detail::SyncEitherImpl<DATA, ERROR>>
+    : std::bool_constant<
+          is_trivially_relocatable_v<DATA>
+          && is_trivially_relocatable_v<detail::StoredError<ERROR>>>
+{
+};
+
+/**
+ * @brief Either for coroutines that never suspend.
+ *
+ * Awaits Either, ValueEither and SyncEither results only; awaiting anything
+ * else, such as a Task, does not compile. In exchange it always holds a
+ * result when returned and its moves never touch the coroutine promise.
+ * Either and AsyncEither coroutines can await it like an Either.
+ *
+ * @code
+ * SyncEither<double, Error> divideStr(std::string num, std::string den) {
+ *     double x = co_await parseDouble(num);
+ *     double y = co_await parseDouble(den);
+ *     co_return co_await divide(x, y);
+ * }
+ * @endcode
+ *
+ * @see detail::SyncEitherImpl for implementation details.
+ */
+template <typename DATA, typename ERROR>
+using SyncEither = std::conditional_t<
+    std::is_same_v<DATA, void>,
+    detail::SyncEitherImpl<Void, ERROR>,
+    detail::SyncEitherImpl<DATA, ERROR>>;
+} // namespace ropic
+
+#include "sync_either_awaiters.inl"
+#include "sync_either_promise.inl"
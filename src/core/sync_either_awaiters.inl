@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <cassert>
+#include <coroutine>
+#include <type_traits>
+#include <utility>
+
+#include "sync_either.hpp"
+#include "value_either.hpp"
+#include "void.hpp"
+
+namespace ropic::detail
+{
+/**
+ * @brief Awaiter propagating errors out of a SyncEither coroutine.
+ *
+ * Used when co_await-ing an EitherImpl, ValueEither or SyncEitherImpl with
+ * the same ERROR inside a SyncEitherImpl<DATA, ERROR> coroutine. The awaited
+ * result is already finished, so this never waits: on error it stores the
+ * error as the result and destroys the coroutine; on success it extracts and
+ * returns the data value.
+ */
+template <typename DATA, typename ERROR>
+template <typename OTHER, bool IS_LVALUE, typename SOURCE>
+class SyncEitherImpl<DATA, ERROR>::PropagatingAwaiter
+{
+  std::conditional_t<IS_LVALUE, SOURCE&, SOURCE&&> _awaitableEither;
+  SyncEitherImpl& _returnEither;
+
+public:
+  explicit PropagatingAwaiter(
+      SOURCE&& awaitableEither, SyncEitherImpl& returnEither) noexcept
+    requires(!IS_LVALUE)
+      : _awaitableEither{std::move(awaitableEither)},
+        _returnEither{returnEither}
+  {
+  }
+
+  explicit PropagatingAwaiter(
+      SOURCE& awaitableEither, SyncEitherImpl& returnEither) noexcept
+    requires(IS_LVALUE)
+      : _awaitableEither{awaitableEither}, _returnEither{returnEither}
+  {
+  }
+
+  // NOLINTBEGIN(readability-identifier-naming)
+  /// @brief Returns true if data exists (no suspension needed).
+  [[nodiscard]]
+  auto await_ready() noexcept -> bool
+  {
+    assert(
+        _awaitableEither.done()
+        && "SyncEither coroutines can only await finished results");
+    return static_cast<bool>(_awaitableEither.data());
+  }
+
+  /// @brief Propagates error to caller and destroys the coroutine.
+  ///
+  /// Errors of an awaited EitherImpl or SyncEitherImpl temporary are handed
+  /// over in their stored form, so boxed errors move without a new
+  /// allocation. An lvalue keeps its box, holding the moved-from error.
+  void await_suspend(std::coroutine_handle<Promise> h)
+      noexcept(std::is_nothrow_move_constructible_v<Stored>)
+  {
+    if constexpr (
+        !IS_LVALUE && !std::is_same_v<SOURCE, ValueEither<OTHER, ERROR>>)
+    {
+      _returnEither._takeError(_awaitableEither);
+    }
+    else
+    {
+      auto err = _awaitableEither.error();
+      assert(err && "`await_suspend` must be called with error state");
+
+      _returnEither._setError(std::move(*err));
+    }
+    h.destroy();
+  }
+
+  /// @brief No-op for Void data type.
+  void await_resume() noexcept
+    requires(std::is_same_v<OTHER, Void>)
+  {
+  }
+
+  /// @brief Moves the data value out of the awaited temporary (rvalue).
+  [[nodiscard]]
+  auto await_resume() noexcept(std::is_nothrow_move_assignable_v<OTHER>)
+      -> OTHER
+    requires(!std::is_same_v<OTHER, Void> && !IS_LVALUE)
+  {
+    return std::move(_awaitableEither).takeData();
+  }
+
+  /// @brief Returns reference to data value (lvalue).
+  [[nodiscard]]
+  auto await_resume() noexcept -> OTHER&
+    requires(!std::is_same_v<OTHER, Void> && IS_LVALUE)
+  {
+    auto d = _awaitableEither.data();
+    assert(d && "SyncEitherImpl must contain data");
+
+    return *d;
+  }
+  // NOLINTEND(readability-identifier-naming)
+};
+} // namespace ropic::detail
@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "frame_promise.hpp"
+#include "in_place.hpp"
+#include "sync_either.hpp"
+#include "value_either.hpp"
+
+namespace ropic::detail
+{
+/// @brief False for every `T`; delays a static_assert to instantiation.
+template <typename T>
+inline constexpr bool FOREIGN_AWAITABLE = false;
+
+/**
+ * @brief Promise type for SyncEither coroutines.
+ *
+ * Controls coroutine lifecycle: immediate start, no final suspend, and stores
+ * co_return values directly into the SyncEitherImpl being returned. Only
+ * Either results can be awaited, so the body always runs to completion (or
+ * to its first error) before the SyncEitherImpl reaches the caller.
+ */
+template <typename DATA, typename ERROR>
+class SyncEitherImpl<DATA, ERROR>::Promise
+    : public FramePromise<SyncEitherImpl>
+{
+  SyncEitherImpl* _either = nullptr;
+
+public:
+  using DataType = DATA;
+
+  /// @brief Binds this promise to the SyncEitherImpl being returned.
+  void setEither(SyncEitherImpl* either) noexcept
+  {
+    assert(either);
+    _either = either;
+  }
+
+  // NOLINTBEGIN(readability-identifier-naming)
+  /// @brief Creates the SyncEitherImpl this promise writes into.
+  [[nodiscard]]
+  auto get_return_object() noexcept -> SyncEitherImpl
+  {
+    return SyncEitherImpl{*this};
+  }
+
+  /// @brief Starts execution immediately (no initial suspend).
+  [[nodiscard]]
+  auto initial_suspend() noexcept -> std::suspend_never
+  {
+    return {};
+  }
+
+  /// @brief Handles co_return with a DATA value, moved into the result.
+  void return_value(DATA&& value)
+      noexcept(std::is_nothrow_move_constructible_v<DATA>)
+  {
+    _either->_setData(std::move(value));
+  }
+
+  /// @brief Handles co_return with a DATA value, copied into the result.
+  void return_value(const DATA& value)
+      noexcept(std::is_nothrow_copy_constructible_v<DATA>)
+  {
+    _either->_setData(value);
+  }
+
+  /// @brief Handles co_return with an ERROR value, moved into the result.
+  void return_value(ERROR&& value) noexcept(noexcept(
+      std::declval<SyncEitherImpl&>()._setError(std::declval<ERROR&&>())))
+  {
+    _either->_setError(std::move(value));
+  }
+
+  /// @brief Handles co_return with an ERROR value, copied into the result.
+  void return_value(const ERROR& value) noexcept(noexcept(
+      std::declval<SyncEitherImpl&>()._setError(std::declval<const ERROR&>())))
+  {
+    _either->_setError(value);
+  }
+
+  /// @brief Handles `co_return ropic::in_place(args...)`: constructs DATA
+  /// directly in the result.
+  template <typename... ARGS>
+  void return_value(InPlaceData<ARGS...> place)
+      noexcept(std::is_nothrow_constructible_v<DATA, ARGS&&...>)
+  {
+    std::apply(
+        [this](ARGS&&... args)
+        { _either->_setData(std::forward<ARGS>(args)...); },
+        std::move(place.args));
+  }
+
+  /// @brief Handles `co_return ropic::in_place_error(args...)`: constructs
+  /// ERROR directly in the result.
+  template <typename... ARGS>
+  void return_value(InPlaceError<ARGS...> place) noexcept(noexcept(
+      std::declval<SyncEitherImpl&>()._setError(std::declval<ARGS&&>()...)))
+  {
+    std::apply(
+        [this](ARGS&&... args)
+        { _either->_setError(std::forward<ARGS>(args)...); },
+        std::move(place.args));
+  }
+
+  /// @brief Runs to the end; the frame is freed before returning.
+  [[nodiscard]]
+  auto final_suspend() noexcept -> std::suspend_never
+  {
+    return {};
+  }
+
+  /// @brief Terminates on unhandled exceptions.
+  void unhandled_exception() noexcept { std::terminate(); }
+
+  /// @brief Rejects awaitables that could suspend the coroutine.
+  template <typename T>
+  auto await_transform(T&& awaitable) -> T&&
+  {
+    static_assert(
+        FOREIGN_AWAITABLE<T>,
+        "SyncEither coroutines can only co_await Either, ValueEither or "
+        "SyncEither with the same `ERROR`; use Either or AsyncEither to await "
+        "other types");
+    return static_cast<T&&>(awaitable);
+  }
+
+  /// @brief Transforms rvalue EitherImpl to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(EitherImpl<OTHER, ERROR>&& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, false, EitherImpl<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, false, EitherImpl<OTHER, ERROR>>{
+        std::move(awaitable), *_either};
+  }
+
+  /// @brief Transforms lvalue EitherImpl to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(EitherImpl<OTHER, ERROR>& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, true, EitherImpl<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, true, EitherImpl<OTHER, ERROR>>{
+        awaitable, *_either};
+  }
+
+  /// @brief Transforms rvalue ValueEither to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(ValueEither<OTHER, ERROR>&& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, false, ValueEither<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, false, ValueEither<OTHER, ERROR>>{
+        std::move(awaitable), *_either};
+  }
+
+  /// @brief Transforms lvalue ValueEither to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(ValueEither<OTHER, ERROR>& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, true, ValueEither<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, true, ValueEither<OTHER, ERROR>>{
+        awaitable, *_either};
+  }
+
+  /// @brief Transforms rvalue SyncEitherImpl to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(SyncEitherImpl<OTHER, ERROR>&& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, false, SyncEitherImpl<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, false, SyncEitherImpl<OTHER, ERROR>>{
+        std::move(awaitable), *_either};
+  }
+
+  /// @brief Transforms lvalue SyncEitherImpl to PropagatingAwaiter for error
+  /// propagation.
+  template <typename OTHER>
+  auto await_transform(SyncEitherImpl<OTHER, ERROR>& awaitable) noexcept
+      -> PropagatingAwaiter<OTHER, true, SyncEitherImpl<OTHER, ERROR>>
+  {
+    return PropagatingAwaiter<OTHER, true, SyncEitherImpl<OTHER, ERROR>>{
+        awaitable, *_either};
+  }
+  // NOLINTEND(readability-identifier-naming)
+};
+} // namespace ropic::detail
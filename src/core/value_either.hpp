@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <cassert>
+#include <type_traits>
+
+#include "borrower.hpp"
+#include "either_concept.hpp"
+
+namespace ropic
+{
+/**
+ * @brief Value-mode Either for trivially copyable DATA and ERROR.
+ *
+ * Unlike Either, it never owns a coroutine, so it is itself trivially
+ * copyable and trivially destructible and small instances are passed and
+ * returned in registers. It cannot be a coroutine return type, but it can be
+ * co_awaited inside an Either coroutine with the same ERROR type: errors are
+ * propagated and data is unwrapped exactly as for Either. It is usable in
+ * constant expressions.
+ *
+ * @code
+ * ValueEither<int, ErrorCode> parseDigit(char c) noexcept {
+ *     if (c < '0' || c > '9') return ErrorCode::NOT_A_DIGIT;
+ *     return c - '0';
+ * }
+ *
+ * Either<int, ErrorCode> parseNumber(std::string_view text) {
+ *     int value = 0;
+ *     for (char c : text)
+ *         value = value * 10 + co_await parseDigit(c);
+ *     co_return value;
+ * }
+ * @endcode
+ */
+template <typename DATA, typename ERROR>
+class ValueEither
+{
+  static_assert(
+      detail::either_concept<DATA, ERROR>,
+      "`DATA` and `ERROR` must not be identical and not be reference, const, "
+      "void or monostate types");
+  static_assert(
+      std::is_trivially_copyable_v<DATA> && std::is_trivially_copyable_v<ERROR>,
+      "ValueEither requires trivially copyable `DATA` and `ERROR`; use Either");
+
+  union
+  {
+    DATA _data;
+    ERROR _error;
+  };
+  bool _holdsData;
+
+public:
+  /// @brief Constructs a ValueEither containing an error.
+  constexpr ValueEither(ERROR e) noexcept : _error(e), _holdsData(false) {}
+
+  /// @brief Constructs a ValueEither containing data.
+  constexpr ValueEither(DATA d) noexcept : _data(d), _holdsData(true) {}
+
+  /**
+   * @brief Returns optional reference to error if present, empty Borrower
+   * otherwise.
+   * @warning Returned Borrower becomes dangling after ValueEither is
+   * destroyed.
+   */
+  [[nodiscard]]
+  constexpr auto error() noexcept -> Borrower<ERROR>
+  {
+    return Borrower<ERROR>{_holdsData ? nullptr : &_error};
+  }
+
+  /// @copydoc error()
+  [[nodiscard]]
+  constexpr auto error() const noexcept -> Borrower<const ERROR>
+  {
+    return Borrower<const ERROR>{_holdsData ? nullptr : &_error};
+  }
+
+  /**
+   * @brief Returns optional reference to data if present, empty Borrower
+   * otherwise.
+   * @warning Returned Borrower becomes dangling after ValueEither is
+   * destroyed.
+   */
+  [[nodiscard]]
+  constexpr auto data() noexcept -> Borrower<DATA>
+  {
+    return Borrower<DATA>{_holdsData ? &_data : nullptr};
+  }
+
+  /// @copydoc data()
+  [[nodiscard]]
+  constexpr auto data() const noexcept -> Borrower<const DATA>
+  {
+    return Borrower<const DATA>{_holdsData ? &_data : nullptr};
+  }
+
+  /// @brief Returns the data.
+  /// @pre data() is not empty.
+  [[nodiscard]]
+  constexpr auto takeData() && noexcept -> DATA
+  {
+    assert(_holdsData && "ValueEither must contain data");
+    return _data;
+  }
+
+  /// @brief Returns the error.
+  /// @pre error() is not empty.
+  [[nodiscard]]
+  constexpr auto takeError() && noexcept -> ERROR
+  {
+    assert(!_holdsData && "ValueEither must contain an error");
+    return _error;
+  }
+
+  /// @brief Always true: a ValueEither holds data or an error.
+  [[nodiscard]]
+  constexpr auto done() const noexcept -> bool
+  {
+    return true;
+  }
+};
+} // namespace ropic
@@ -13,6 +13,12 @@
  */
 
 // IWYU pragma: begin_exports
+#include "core/async_either.hpp"
 #include "core/either.hpp"
+#include "core/either_column.hpp"
+#include "core/either_pipe.hpp"
+#include "core/either_try.hpp"
+#include "core/relocating_vector.hpp"
+#include "core/sync_either.hpp"
 
 // IWYU pragma: end_exports
\ No newline at end of file
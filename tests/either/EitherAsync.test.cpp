@@ -0,0 +1,313 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <gtest/gtest.h>
+#include <list>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "TestHelpers.hpp"
+
+// NOLINTBEGIN(readability-magic-numbers)
+namespace
+{
+static_assert(sizeof(AsyncEither<TestData, TestError>) == sizeof(void*));
+static_assert(
+    std::is_nothrow_move_constructible_v<AsyncEither<TestData, TestError>>);
+static_assert(std::is_nothrow_move_assignable_v<AsyncEither<int, TestError>>);
+
+auto parkedValue(std::coroutine_handle<>* parked, int value)
+    -> AsyncEither<TestData, TestError>
+{
+  co_await ParkingAwaitable{parked};
+  co_return TestData{value, "parked"};
+}
+
+auto parkedCheck(std::coroutine_handle<>* parked, int value)
+    -> AsyncEither<void, std::string>
+{
+  co_await ParkingAwaitable{parked};
+  if (value < 0)
+    co_return std::string{"negative"};
+  co_return OK;
+}
+
+/// Sets `*destroyed` as the coroutine holding it finishes, late enough for
+/// a poller to see done() first if the result were published too early.
+struct SlowLocal
+{
+  std::atomic<bool>* destroyed;
+
+  explicit SlowLocal(std::atomic<bool>* d) noexcept : destroyed(d) {}
+  SlowLocal(const SlowLocal&) = delete;
+  SlowLocal(SlowLocal&&) = delete;
+  auto operator=(const SlowLocal&) -> SlowLocal& = delete;
+  auto operator=(SlowLocal&&) -> SlowLocal& = delete;
+  ~SlowLocal()
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    destroyed->store(true);
+  }
+};
+
+auto parkedWithLocal(
+    std::coroutine_handle<>* parked, std::atomic<bool>* destroyed, int value)
+    -> AsyncEither<TestData, std::string>
+{
+  const SlowLocal local{destroyed};
+  co_await ParkingAwaitable{parked};
+  auto checked = value < 0 ? returnError("negative") : returnData(value);
+  const int number = co_await std::move(checked);
+  co_return TestData{number, "parked"};
+}
+
+auto asyncData(int value) -> AsyncEither<int, std::string> { co_return value; }
+
+auto asyncError(std::string message) -> AsyncEither<int, std::string>
+{
+  co_return message;
+}
+
+auto addAll(Either<int, std::string> first, int second)
+    -> AsyncEither<int, std::string>
+{
+  const int a = co_await std::move(first);
+  const int b = co_await asyncData(second);
+  co_return a + b;
+}
+
+auto failInAsync() -> AsyncEither<int, std::string>
+{
+  const int value = co_await asyncError("async failure");
+  co_return value + 1;
+}
+
+auto failInEither() -> Either<int, std::string>
+{
+  const int value = co_await asyncError("either failure");
+  co_return value + 1;
+}
+
+auto parkedNumber(std::coroutine_handle<>* parked, int value)
+    -> AsyncEither<int, std::string>
+{
+  co_await ParkingAwaitable{parked};
+  if (value < 0)
+    co_return std::string{"negative"};
+  co_return value;
+}
+
+auto awaitParkedInEither(std::coroutine_handle<>* parked, int value)
+    -> Either<int, std::string>
+{
+  const int number = co_await parkedNumber(parked, value);
+  co_return number + 1;
+}
+
+auto awaitParkedInAsync(std::coroutine_handle<>* parked, int value)
+    -> AsyncEither<int, std::string>
+{
+  auto pending = parkedNumber(parked, value);
+  const int number = co_await pending;
+  co_return number * 2;
+}
+
+auto awaitNestedInAsync(std::coroutine_handle<>* parked, int value)
+    -> AsyncEither<int, std::string>
+{
+  const int number = co_await awaitParkedInAsync(parked, value);
+  co_return number + 1;
+}
+
+auto awaitLvalue() -> Either<int, std::string>
+{
+  auto pending = asyncData(4);
+  int& value = co_await pending;
+  value += 1;
+  co_return *pending.data();
+}
+} // namespace
+
+TEST(EitherAsync, UNIT_073_MovesKeepPendingResult)
+{
+  RecordProperty("id", "0.01-UNIT-073");
+  RecordProperty(
+      "desc", "A pending AsyncEither moves as a handle and gets its result");
+
+  std::coroutine_handle<> parked;
+  auto pending = parkedValue(&parked, 7);
+  ASSERT_FALSE(pending.done());
+  EXPECT_FALSE(pending.data());
+  EXPECT_FALSE(pending.error());
+
+  std::vector<AsyncEither<TestData, TestError>> tasks;
+  tasks.push_back(std::move(pending));
+  tasks.reserve(16);
+  EXPECT_FALSE(pending.done()); // NOLINT(bugprone-use-after-move)
+
+  std::list<AsyncEither<TestData, TestError>> moved;
+  moved.push_back(std::move(tasks.front()));
+  tasks.clear();
+
+  parked.resume();
+  ASSERT_TRUE(moved.front().done());
+  ASSERT_TRUE(moved.front().data());
+  EXPECT_EQ(moved.front().data()->value, 7);
+  EXPECT_EQ(moved.front().data()->name, "parked");
+
+  std::coroutine_handle<> failing;
+  auto check = parkedCheck(&failing, -1);
+  auto other = parkedCheck(&parked, 1);
+  check = std::move(other);
+  parked.resume();
+  ASSERT_TRUE(check.data());
+  EXPECT_FALSE(check.error());
+}
+
+TEST(EitherAsync, UNIT_074_PropagatesErrors)
+{
+  RecordProperty("id", "0.01-UNIT-074");
+  RecordProperty(
+      "desc", "Errors propagate between Either and AsyncEither coroutines");
+
+  auto sum = addAll(returnData(2), 3);
+  ASSERT_TRUE(sum.data());
+  EXPECT_EQ(*sum.data(), 5);
+
+  auto fromEither = addAll(returnError("either"), 3);
+  ASSERT_TRUE(fromEither.done());
+  ASSERT_TRUE(fromEither.error());
+  EXPECT_EQ(*fromEither.error(), "either");
+
+  auto fromAsync = failInAsync();
+  ASSERT_TRUE(fromAsync.error());
+  EXPECT_EQ(*fromAsync.error(), "async failure");
+  EXPECT_FALSE(fromAsync.data());
+
+  auto intoEither = failInEither();
+  ASSERT_TRUE(intoEither.error());
+  EXPECT_EQ(*intoEither.error(), "either failure");
+
+  auto lvalue = awaitLvalue();
+  ASSERT_TRUE(lvalue.data());
+  EXPECT_EQ(*lvalue.data(), 5);
+}
+
+TEST(EitherAsync, UNIT_075_TakeReleasesFrame)
+{
+  RecordProperty("id", "0.01-UNIT-075");
+  RecordProperty("desc", "Taking the payload frees the frame and empties it");
+
+  auto data = asyncData(9);
+  EXPECT_EQ(std::move(data).takeData(), 9);
+  EXPECT_FALSE(data.done()); // NOLINT(bugprone-use-after-move)
+  EXPECT_FALSE(data.data());
+
+  auto error = failInAsync();
+  EXPECT_EQ(std::move(error).takeError(), "async failure");
+  EXPECT_FALSE(error.done()); // NOLINT(bugprone-use-after-move)
+  EXPECT_FALSE(error.error());
+}
+
+TEST(EitherAsync, UNIT_093_DonePolledFromAnotherThread)
+{
+  RecordProperty("id", "0.01-UNIT-093");
+  RecordProperty(
+      "desc",
+      "A result seen done() on another thread is safe to use and destroy");
+
+  for (int i = -10; i < 10; ++i)
+  {
+    std::coroutine_handle<> parked;
+    std::atomic<bool> destroyed = false;
+    auto task = parkedWithLocal(&parked, &destroyed, i);
+    ASSERT_FALSE(task.done());
+
+    std::thread finisher([parked] { parked.resume(); });
+    while (!task.done())
+      std::this_thread::yield();
+
+    if (i < 0)
+    {
+      // Parked for good at the co_await that propagated the error
+      ASSERT_TRUE(task.error());
+      EXPECT_EQ(*task.error(), "negative");
+    }
+    else
+    {
+      // The coroutine has run to completion, its locals included
+      EXPECT_TRUE(destroyed.load());
+      ASSERT_TRUE(task.data());
+      EXPECT_EQ(task.data()->value, i);
+    }
+    // Destroys the frame while the finishing thread may still be returning
+    {
+      auto finished = std::move(task);
+    }
+    finisher.join();
+  }
+}
+
+TEST(EitherAsync, UNIT_094_AwaitsPendingResult)
+{
+  RecordProperty("id", "0.01-UNIT-094");
+  RecordProperty(
+      "desc",
+      "Awaiting a pending AsyncEither suspends until its result is published");
+
+  std::coroutine_handle<> parked;
+  auto inEither = awaitParkedInEither(&parked, 4);
+  ASSERT_FALSE(inEither.done());
+  auto movedEither = std::move(inEither);
+  parked.resume();
+  ASSERT_TRUE(movedEither.done());
+  ASSERT_TRUE(movedEither.data());
+  EXPECT_EQ(*movedEither.data(), 5);
+
+  auto failedEither = awaitParkedInEither(&parked, -1);
+  ASSERT_FALSE(failedEither.done());
+  parked.resume();
+  ASSERT_TRUE(failedEither.error());
+  EXPECT_EQ(*failedEither.error(), "negative");
+
+  auto inAsync = awaitNestedInAsync(&parked, 3);
+  ASSERT_FALSE(inAsync.done());
+  parked.resume();
+  ASSERT_TRUE(inAsync.done());
+  ASSERT_TRUE(inAsync.data());
+  EXPECT_EQ(*inAsync.data(), 7);
+
+  auto failedAsync = awaitNestedInAsync(&parked, -1);
+  ASSERT_FALSE(failedAsync.done());
+  parked.resume();
+  ASSERT_TRUE(failedAsync.error());
+  EXPECT_EQ(*failedAsync.error(), "negative");
+
+  // Finished by another thread, which resumes the awaiting coroutines
+  for (int i = -10; i < 10; ++i)
+  {
+    auto task = awaitNestedInAsync(&parked, i);
+    std::thread finisher([parked] { parked.resume(); });
+    while (!task.done())
+      std::this_thread::yield();
+
+    if (i < 0)
+    {
+      ASSERT_TRUE(task.error());
+      EXPECT_EQ(*task.error(), "negative");
+    }
+    else
+    {
+      ASSERT_TRUE(task.data());
+      EXPECT_EQ(*task.data(), (i * 2) + 1);
+    }
+    finisher.join();
+  }
+}
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <string>
+
+#include "TestHelpers.hpp"
+
+// NOLINTBEGIN(readability-magic-numbers)
+namespace
+{
+enum class ErrorCode : std::uint8_t
+{
+  NEGATIVE,
+};
+
+auto divide(double num, double den) -> Either<double, TestError>
+{
+  if (den == 0.0)
+    co_return TestError{1, "division by zero"};
+  co_return num / den;
+}
+
+auto fillColumn(int rows) -> EitherColumn<double, TestError>
+{
+  EitherColumn<double, TestError> column;
+  for (int i = 0; i < rows; ++i)
+    column.push_back(divide(i, i % 7 == 0 ? 0.0 : 1.0));
+  return column;
+}
+} // namespace
+
+TEST(EitherColumn, UNIT_079_PushAndAccess)
+{
+  RecordProperty("id", "0.01-UNIT-079");
+  RecordProperty(
+      "desc", "EitherColumn stores data densely and errors by row index");
+
+  auto column = fillColumn(200);
+  ASSERT_EQ(column.size(), 200U);
+  EXPECT_EQ(column.errorCount(), 29U);
+  EXPECT_EQ(column.values().size(), 200U);
+  EXPECT_EQ(column.validity().size(), 4U);
+
+  EXPECT_FALSE(column.holdsData(0));
+  EXPECT_TRUE(column.holdsData(1));
+  EXPECT_FALSE(column.holdsData(196));
+  ASSERT_TRUE(column[5].data());
+  EXPECT_EQ(*column[5].data(), 5.0);
+  EXPECT_FALSE(column[5].error());
+  ASSERT_TRUE(column[140].error());
+  EXPECT_EQ(column[140].error()->message, "division by zero");
+  EXPECT_FALSE(column[140].data());
+
+  EXPECT_EQ(column.errors()[2].index, 14U);
+
+  column.pushData(2.5);
+  column.pushError(TestError{2, "late"});
+  EXPECT_EQ(column.size(), 202U);
+  EXPECT_EQ(column[201].error()->code, 2);
+}
+
+TEST(EitherColumn, UNIT_080_SumAndIterate)
+{
+  RecordProperty("id", "0.01-UNIT-080");
+  RecordProperty(
+      "desc", "Data sums over contiguous values; iteration visits every row");
+
+  auto column = fillColumn(100);
+
+  auto values = column.values();
+  const double sum = std::accumulate(values.begin(), values.end(), 0.0);
+  double expected = 0.0;
+  for (int i = 0; i < 100; ++i)
+    expected += i % 7 == 0 ? 0.0 : i;
+  EXPECT_EQ(sum, expected);
+
+  std::size_t rows = 0;
+  std::size_t errors = 0;
+  for (auto row : column)
+  {
+    if (auto err = row.error())
+    {
+      EXPECT_EQ(err->code, 1);
+      ++errors;
+    }
+    else
+    {
+      EXPECT_EQ(*row.data(), static_cast<double>(rows));
+    }
+    ++rows;
+  }
+  EXPECT_EQ(rows, 100U);
+  EXPECT_EQ(errors, column.errorCount());
+}
+
+TEST(EitherColumn, UNIT_081_ConvertBack)
+{
+  RecordProperty("id", "0.01-UNIT-081");
+  RecordProperty("desc", "Rows convert back into Eithers");
+
+  auto column = fillColumn(10);
+
+  auto data = column.either(3);
+  ASSERT_TRUE(data.data());
+  EXPECT_EQ(*data.data(), 3.0);
+
+  auto error = column.either(7);
+  ASSERT_TRUE(error.error());
+  EXPECT_EQ(error.error()->code, 1);
+
+  column.clear();
+  EXPECT_TRUE(column.empty());
+  column.push_back(divide(1.0, 4.0));
+  EXPECT_EQ(column.values()[0], 0.25);
+  EXPECT_TRUE(column.holdsData(0));
+
+  EitherColumn<int, ErrorCode> codes;
+  codes.push_back(ValueEither<int, ErrorCode>{4});
+  codes.push_back(ValueEither<int, ErrorCode>{ErrorCode::NEGATIVE});
+  EXPECT_EQ(*codes.either(0).data(), 4);
+  EXPECT_EQ(*codes.either(1).error(), ErrorCode::NEGATIVE);
+}
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "TestHelpers.hpp"
+
+// NOLINTBEGIN(readability-magic-numbers)
+namespace
+{
+enum class ErrorCode : std::uint8_t
+{
+  NEGATIVE,
+  TOO_LARGE,
+};
+
+auto checkPositive(int value) -> Either<int, ErrorCode>
+{
+  if (value < 0)
+    return ErrorCode::NEGATIVE;
+  return value;
+}
+
+auto checkSmall(int value) -> Either<int, ErrorCode>
+{
+  if (value > 100)
+    return ErrorCode::TOO_LARGE;
+  return value;
+}
+
+auto parse(const std::string& text) -> Either<int, TestError>
+{
+  if (text.empty())
+    co_return TestError{1, "empty"};
+  co_return std::stoi(text);
+}
+} // namespace
+
+TEST(EitherCombinators, UNIT_082_MapAndThen)
+{
+  RecordProperty("id", "0.01-UNIT-082");
+  RecordProperty(
+      "desc", "map and and_then chain value-mode Eithers, errors pass through");
+
+  auto doubled = checkPositive(21).map([](int v) { return v * 2; });
+  static_assert(std::is_same_v<decltype(doubled), Either<int, ErrorCode>>);
+  EXPECT_EQ(*doubled.data(), 42);
+
+  auto text = checkPositive(7).map([](int v) { return std::to_string(v); });
+  EXPECT_EQ(*text.data(), "7");
+
+  auto chained = checkPositive(50).and_then(checkSmall).map(
+      [](int v) { return v + 1; });
+  EXPECT_EQ(*chained.data(), 51);
+
+  int calls = 0;
+  auto failed = checkPositive(-1)
+                    .and_then(
+                        [&calls](int v)
+                        {
+                          ++calls;
+                          return checkSmall(v);
+                        })
+                    .map(
+                        [&calls](int v)
+                        {
+                          ++calls;
+                          return v;
+                        });
+  EXPECT_EQ(calls, 0);
+  EXPECT_EQ(*failed.error(), ErrorCode::NEGATIVE);
+
+  auto tooLarge = checkPositive(500).and_then(checkSmall);
+  EXPECT_EQ(*tooLarge.error(), ErrorCode::TOO_LARGE);
+
+  // Void-returning callables give a void-like Either
+  int seen = 0;
+  auto unit = checkPositive(3).map([&seen](int v) { seen = v; });
+  static_assert(std::is_same_v<decltype(unit), Either<void, ErrorCode>>);
+  EXPECT_EQ(seen, 3);
+  EXPECT_EQ(*unit.data(), OK);
+  auto next = std::move(unit).map([] { return 9; });
+  EXPECT_EQ(*next.data(), 9);
+}
+
+TEST(EitherCombinators, UNIT_083_OrElseAndTransformError)
+{
+  RecordProperty("id", "0.01-UNIT-083");
+  RecordProperty(
+      "desc", "or_else recovers from errors, transform_error maps them");
+
+  auto recovered = checkPositive(-5).or_else(
+      [](ErrorCode code) -> Either<int, TestError>
+      {
+        if (code == ErrorCode::NEGATIVE)
+          return 0;
+        return TestError{2, "unexpected"};
+      });
+  EXPECT_EQ(*recovered.data(), 0);
+
+  auto kept = checkPositive(8).or_else(
+      [](ErrorCode) -> Either<int, TestError> { return 0; });
+  EXPECT_EQ(*kept.data(), 8);
+
+  auto described = checkPositive(-5).transform_error(
+      [](ErrorCode) { return TestError{3, "negative"}; });
+  static_assert(std::is_same_v<decltype(described), Either<int, TestError>>);
+  ASSERT_TRUE(described.error());
+  EXPECT_EQ(described.error()->message, "negative");
+
+  auto untouched = checkSmall(4).transform_error(
+      [](ErrorCode) { return TestError{3, "unreachable"}; });
+  EXPECT_EQ(*untouched.data(), 4);
+
+  auto code = parse("").transform_error(
+      [](const TestError& e)
+      { return e.code == 1 ? ErrorCode::NEGATIVE : ErrorCode::TOO_LARGE; });
+  EXPECT_EQ(*code.error(), ErrorCode::NEGATIVE);
+}
+
+TEST(EitherCombinators, UNIT_084_ValueOrAndFinishedCoroutines)
+{
+  RecordProperty("id", "0.01-UNIT-084");
+  RecordProperty(
+      "desc", "value_or picks a fallback; finished coroutines compose too");
+
+  EXPECT_EQ(checkPositive(-1).value_or(10), 10);
+  EXPECT_EQ(checkPositive(6).value_or(10), 6);
+
+  const auto parsed = parse("12");
+  EXPECT_EQ(parsed.value_or(0), 12);
+  EXPECT_EQ(parsed.value_or(0), 12);
+
+  auto message = parse("")
+                     .map([](int v) { return std::to_string(v); })
+                     .value_or("none");
+  EXPECT_EQ(message, "none");
+
+  auto data = parse("5")
+                  .and_then([](int v) { return parse(std::to_string(v * 3)); })
+                  .map([](int v) { return TestData{v, "tripled"}; });
+  ASSERT_TRUE(data.data());
+  EXPECT_EQ(data.data()->value, 15);
+}
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string_view>
+
+#include "TestHelpers.hpp"
+
+// NOLINTBEGIN(readability-magic-numbers)
+namespace
+{
+enum class ConfigError : std::uint8_t
+{
+  EMPTY,
+  NOT_A_NUMBER,
+  OUT_OF_RANGE,
+};
+
+constexpr auto parseNumber(std::string_view text) -> Either<int, ConfigError>
+{
+  if (text.empty())
+    return ConfigError::EMPTY;
+  int value = 0;
+  for (char c : text)
+  {
+    if (c < '0' || c > '9')
+      return ConfigError::NOT_A_NUMBER;
+    value = value * 10 + (c - '0');
+  }
+  return value;
+}
+
+constexpr auto checkPort(int port) -> Either<int, ConfigError>
+{
+  if (port > 65535)
+    return ConfigError::OUT_OF_RANGE;
+  return port;
+}
+
+constexpr auto requireField(std::string_view text) -> Either<Void, ConfigError>
+{
+  if (text.empty())
+    return ConfigError::EMPTY;
+  return OK;
+}
+
+/// Port of a valid field, or `fallback`.
+constexpr auto portOr(std::string_view text, int fallback) -> int
+{
+  return parseNumber(text)
+      .and_then(checkPort)
+      .map([](int port) { return port; })
+      .value_or(fallback);
+}
+
+constexpr auto errorOf(std::string_view text) -> ConfigError
+{
+  return parseNumber(text).and_then(checkPort).takeError();
+}
+
+constexpr auto recovered(std::string_view text) -> int
+{
+  return parseNumber(text)
+      .or_else([](ConfigError) -> Either<int, ConfigError> { return 2; })
+      .takeData();
+}
+
+constexpr auto errorCode(std::string_view text) -> long
+{
+  return parseNumber(text)
+      .transform_error([](ConfigError error)
+                       { return static_cast<long>(error) + 10; })
+      .takeError();
+}
+
+constexpr auto pipedOffset(std::string_view text) -> int
+{
+  return ropic::pipe(checkPort, [](int port) { return port - 1024; })(
+             parseNumber(text))
+      .value_or(-1);
+}
+
+constexpr auto hasField(std::string_view text) -> bool
+{
+  return requireField(text).done() && !requireField(text).error();
+}
+
+constexpr auto fieldError(std::string_view text) -> ConfigError
+{
+  return requireField(text).takeError();
+}
+
+constexpr auto checkedPort(std::string_view text) -> int
+{
+  return requireField(text)
+      .and_then([text] { return parseNumber(text); })
+      .value_or(0);
+}
+
+constexpr auto valueEitherError() -> ConfigError
+{
+  return *ValueEither<int, ConfigError>{ConfigError::EMPTY}.error();
+}
+
+// Compile-time table built with the runtime error type
+constexpr std::array<std::string_view, 4> PORT_TEXTS{"80", "", "8o", "70000"};
+
+constexpr auto validatePorts() -> std::array<int, 4>
+{
+  std::array<int, 4> ports{};
+  for (std::size_t i = 0; i < PORT_TEXTS.size(); ++i)
+    ports[i] = portOr(PORT_TEXTS[i], -1);
+  return ports;
+}
+
+constexpr std::array<int, 4> PORTS = validatePorts();
+} // namespace
+
+// Value mode and combinators
+static_assert(portOr("8080", 0) == 8080);
+static_assert(portOr("99999", 0) == 0);
+static_assert(errorOf("") == ConfigError::EMPTY);
+static_assert(errorOf("1x") == ConfigError::NOT_A_NUMBER);
+static_assert(errorOf("99999") == ConfigError::OUT_OF_RANGE);
+static_assert(PORTS[0] == 80 && PORTS[1] == -1 && PORTS[2] == -1);
+static_assert(PORTS[3] == -1);
+static_assert(recovered("") == 2 && recovered("5") == 5);
+static_assert(errorCode("x") == 11);
+
+// Void data
+static_assert(hasField("80") && !hasField(""));
+static_assert(fieldError("") == ConfigError::EMPTY);
+static_assert(checkedPort("443") == 443 && checkedPort("") == 0);
+
+// Fused pipelines
+static_assert(pipedOffset("1025") == 1 && pipedOffset("70000") == -1);
+
+// Constant Either objects
+constexpr Either<int, ConfigError> DEFAULT_PORT{8080};
+static_assert(DEFAULT_PORT.done());
+static_assert(*DEFAULT_PORT.data() == 8080);
+static_assert(!DEFAULT_PORT.error());
+
+constexpr Either<Void, ConfigError> MISSING_FIELD{ConfigError::EMPTY};
+static_assert(MISSING_FIELD.done());
+static_assert(*MISSING_FIELD.error() == ConfigError::EMPTY);
+static_assert(!MISSING_FIELD.data());
+
+// ValueEither
+constexpr ValueEither<int, ConfigError> DEFAULT_VALUE{8080};
+static_assert(*DEFAULT_VALUE.data() == 8080);
+static_assert(valueEitherError() == ConfigError::EMPTY);
+
+TEST(EitherConstexpr, UNIT_089_ConstantEvaluation)
+{
+  RecordProperty("id", "0.01-UNIT-089");
+  RecordProperty(
+      "desc", "value-mode Either and combinators work in constant expressions");
+
+  // Same functions at runtime give the same results
+  EXPECT_EQ(portOr("8080", 0), 8080);
+  EXPECT_EQ(errorOf("99999"), ConfigError::OUT_OF_RANGE);
+  EXPECT_EQ(PORTS[0], 80);
+  EXPECT_EQ(*DEFAULT_PORT.data(), 8080);
+  EXPECT_EQ(fieldError(""), ConfigError::EMPTY);
+}
+// NOLINTEND(readability-magic-numbers)
@@ -76,6 +76,7 @@ TEST(EitherCoroutine, UNIT_017_ZeroCopiesOnReturn)
   ASSERT_TRUE(result.data());
   EXPECT_EQ(result.data()->value, 42);
   EXPECT_EQ(MoveTracker::s_copyCount, 0);
+  EXPECT_EQ(MoveTracker::s_moveCount, 1); // Temporary into the result
 }
 
 TEST(EitherCoroutine, UNIT_018_CoawaitBehavior)
@@ -127,12 +128,14 @@ TEST(EitherCoroutine, UNIT_020_CoawaitZeroCopies)
   ASSERT_TRUE(result.data());
   EXPECT_EQ(result.data()->value, 42);
   EXPECT_EQ(MoveTracker::s_copyCount, 0);
+  EXPECT_EQ(MoveTracker::s_moveCount, 3); // Return, unwrap, return
 
   MoveTracker::reset();
   auto errResult = returnIntWithMoveTrackerError(true);
   ASSERT_TRUE(errResult.done());
   ASSERT_TRUE(errResult.error());
   EXPECT_EQ(MoveTracker::s_copyCount, 0);
+  EXPECT_EQ(MoveTracker::s_moveCount, 1);
 }
 
 TEST(EitherCoroutine, UNIT_021_NestedCoroutines)
@@ -194,4 +197,53 @@ TEST(EitherCoroutine, UNIT_024_DeepNesting)
   ASSERT_TRUE(deepError.error());
   EXPECT_EQ(*deepError.error(), "deep error");
 }
+
+TEST(EitherCoroutine, UNIT_070_InPlaceReturn)
+{
+  RecordProperty("id", "0.01-UNIT-070");
+  RecordProperty(
+      "desc", "co_return ropic::in_place constructs the result without moves");
+
+  MoveTracker::reset();
+  auto data = returnMoveTrackerInPlace(5);
+  ASSERT_TRUE(data.data());
+  EXPECT_EQ(data.data()->value, 5);
+  EXPECT_EQ(MoveTracker::s_moveCount, 0);
+  EXPECT_EQ(MoveTracker::s_copyCount, 0);
+
+  MoveTracker::reset();
+  auto error = returnMoveTrackerErrorInPlace(-5);
+  ASSERT_TRUE(error.error());
+  EXPECT_EQ(error.error()->value, -5);
+  EXPECT_EQ(MoveTracker::s_moveCount, 0);
+  EXPECT_EQ(MoveTracker::s_copyCount, 0);
+
+  auto large = []() -> Either<LargeStruct, std::string>
+  { co_return ropic::in_place(std::array<int, 100>{1, 2, 3}, "large"); }();
+  ASSERT_TRUE(large.data());
+  EXPECT_EQ(large.data()->values[2], 3);
+  EXPECT_EQ(large.data()->name, "large");
+}
+
+TEST(EitherCoroutine, UNIT_071_LvalueReturn)
+{
+  RecordProperty("id", "0.01-UNIT-071");
+  RecordProperty(
+      "desc", "co_return moves a local once and copies a const lvalue once");
+
+  MoveTracker::reset();
+  auto named = returnNamedMoveTracker(6);
+  ASSERT_TRUE(named.data());
+  EXPECT_EQ(named.data()->value, 6);
+  EXPECT_EQ(MoveTracker::s_moveCount, 1);
+  EXPECT_EQ(MoveTracker::s_copyCount, 0);
+
+  const MoveTracker source{7};
+  MoveTracker::reset();
+  auto copied = returnConstMoveTracker(source);
+  ASSERT_TRUE(copied.data());
+  EXPECT_EQ(copied.data()->value, 7);
+  EXPECT_EQ(MoveTracker::s_moveCount, 0);
+  EXPECT_EQ(MoveTracker::s_copyCount, 1);
+}
 // NOLINTEND(readability-magic-numbers)
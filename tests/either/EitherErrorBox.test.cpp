@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "TestHelpers.hpp"
+
+using ropic::detail::ErrorPool;
+
+// NOLINTBEGIN(readability-magic-numbers)
+namespace
+{
+struct ColdError
+{
+  static int s_moveCount;
+  int code;
+  std::string message;
+  std::string context;
+
+  ColdError(int c, std::string m, std::string ctx)
+      : code(c), message(std::move(m)), context(std::move(ctx))
+  {
+  }
+  ColdError(const ColdError&) = default;
+  ColdError(ColdError&& other) noexcept
+      : code(other.code),
+        message(std::move(other.message)),
+        context(std::move(other.context))
+  {
+    ++s_moveCount;
+  }
+  auto operator=(const ColdError&) -> ColdError& = default;
+  auto operator=(ColdError&&) -> ColdError& = default;
+  ~ColdError() = default;
+};
+
+int ColdError::s_moveCount = 0;
+} // namespace
+
+template <>
+struct ropic::box_error<ColdError> : std::true_type
+{
+};
+
+namespace
+{
+static_assert(sizeof(Either<int, ColdError>) == sizeof(void*));
+static_assert(sizeof(Either<TestData, ColdError>) < sizeof(ColdError));
+static_assert(sizeof(Either<Void, ColdError>) == sizeof(void*));
+
+auto failDeep(int depth) -> Either<int, ColdError>
+{
+  if (depth == 0)
+    co_return ColdError{7, "deep failure", "at the bottom"};
+  const int value = co_await failDeep(depth - 1);
+  co_return value + 1;
+}
+
+auto failAsync(int depth) -> AsyncEither<int, ColdError>
+{
+  const int value = co_await failDeep(depth);
+  co_return value + 1;
+}
+
+auto awaitLvalue(Either<int, ColdError>& source) -> Either<int, ColdError>
+{
+  const int value = co_await source;
+  co_return value + 1;
+}
+
+auto awaitLvalueSync(Either<int, ColdError>& source)
+    -> SyncEither<int, ColdError>
+{
+  const int value = co_await source;
+  co_return value + 1;
+}
+
+auto awaitLvalueAsync(Either<int, ColdError>& source)
+    -> AsyncEither<int, ColdError>
+{
+  const int value = co_await source;
+  co_return value + 1;
+}
+
+auto succeedDeep(int depth) -> Either<int, ColdError>
+{
+  if (depth == 0)
+    co_return 0;
+  const int value = co_await succeedDeep(depth - 1);
+  co_return value + 1;
+}
+} // namespace
+
+TEST(EitherErrorBox, UNIT_067_BoxedErrorRoundTrip)
+{
+  RecordProperty("id", "0.01-UNIT-067");
+  RecordProperty("desc", "Boxed errors are reachable through error()");
+
+  Either<int, ColdError> failed{ColdError{1, "boom", "ctx"}};
+  ASSERT_TRUE(failed.error());
+  EXPECT_EQ(failed.error()->code, 1);
+  EXPECT_EQ(failed.error()->message, "boom");
+  failed.error()->code = 2;
+  EXPECT_EQ(failed.error()->code, 2);
+  EXPECT_FALSE(failed.data());
+
+  Either<int, ColdError> moved{std::move(failed)};
+  ASSERT_TRUE(moved.error());
+  EXPECT_EQ(moved.error()->context, "ctx");
+
+  Either<int, ColdError> value{5};
+  ASSERT_TRUE(value.data());
+  EXPECT_EQ(*value.data(), 5);
+  EXPECT_FALSE(value.error());
+
+  value = std::move(moved);
+  ASSERT_TRUE(value.error());
+  EXPECT_EQ(value.error()->code, 2);
+
+  const ColdError taken = std::move(value).takeError();
+  EXPECT_EQ(taken.message, "boom");
+  EXPECT_FALSE(value.error()); // NOLINT(bugprone-use-after-move)
+}
+
+TEST(EitherErrorBox, UNIT_068_PropagationKeepsTheBox)
+{
+  RecordProperty("id", "0.01-UNIT-068");
+  RecordProperty(
+      "desc", "A boxed error crosses co_await without being moved again");
+
+  auto succeeded = succeedDeep(10);
+  ASSERT_TRUE(succeeded.data());
+  EXPECT_EQ(*succeeded.data(), 10);
+
+  ErrorPool::local().release();
+  ColdError::s_moveCount = 0;
+  {
+    auto failed = failDeep(10);
+    ASSERT_TRUE(failed.error());
+    EXPECT_EQ(failed.error()->message, "deep failure");
+    EXPECT_EQ(ColdError::s_moveCount, 1); // Into the box only
+  }
+  EXPECT_EQ(ErrorPool::local().cachedBlocks(), 1U);
+
+  ColdError::s_moveCount = 0;
+  {
+    auto failed = failAsync(3);
+    ASSERT_TRUE(failed.error());
+    EXPECT_EQ(failed.error()->code, 7);
+    EXPECT_EQ(ColdError::s_moveCount, 1);
+  }
+  EXPECT_EQ(ErrorPool::local().cachedBlocks(), 1U);
+  ErrorPool::local().release();
+}
+
+TEST(EitherErrorBox, UNIT_069_ErrorFreedOnOtherThread)
+{
+  RecordProperty("id", "0.01-UNIT-069");
+  RecordProperty("desc", "A boxed error can be destroyed on another thread");
+
+  ErrorPool::local().release();
+  auto failed = failDeep(3);
+  ASSERT_TRUE(failed.error());
+
+  std::thread other(
+      [moved = std::move(failed)]() mutable
+      {
+        EXPECT_EQ(moved.error()->code, 7);
+        Either<int, ColdError> sink{0};
+        sink = std::move(moved);
+      });
+  other.join();
+
+  auto again = failDeep(0);
+  ASSERT_TRUE(again.error());
+  EXPECT_EQ(ErrorPool::local().cachedBlocks(), 0U);
+}
+
+TEST(EitherErrorBox, UNIT_092_LvalueSourceKeepsItsError)
+{
+  RecordProperty("id", "0.01-UNIT-092");
+  RecordProperty(
+      "desc", "Propagating from an lvalue leaves it holding its error");
+
+  Either<int, ColdError> source = failDeep(0);
+
+  auto propagated = awaitLvalue(source);
+  ASSERT_TRUE(propagated.error());
+  EXPECT_EQ(propagated.error()->message, "deep failure");
+  ASSERT_TRUE(source.done());
+  ASSERT_TRUE(source.error());
+  EXPECT_EQ(source.error()->code, 7);
+  EXPECT_FALSE(source.data());
+
+  auto sync = awaitLvalueSync(source);
+  ASSERT_TRUE(sync.error());
+  EXPECT_EQ(sync.error()->code, 7);
+  ASSERT_TRUE(source.error());
+
+  auto async = awaitLvalueAsync(source);
+  ASSERT_TRUE(async.error());
+  EXPECT_EQ(async.error()->code, 7);
+  ASSERT_TRUE(source.error());
+  EXPECT_EQ(source.error()->code, 7);
+}
+// NOLINTEND(readability-magic-numbers)
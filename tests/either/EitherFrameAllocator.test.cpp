@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <array>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <memory_resource>
+
+#include "TestHelpers.hpp"
+
+// NOLINTBEGIN(readability-magic-numbers)
+namespace
+{
+struct AllocationLog
+{
+  int allocations = 0;
+  int deallocations = 0;
+};
+
+/// Stateful allocator recording every frame allocation in a shared log.
+template <typename T>
+struct LoggingAllocator
+{
+  using value_type = T;
+
+  AllocationLog* log;
+
+  explicit LoggingAllocator(AllocationLog* l) noexcept : log(l) {}
+
+  template <typename U>
+  LoggingAllocator(const LoggingAllocator<U>& other) noexcept : log(other.log)
+  {
+  }
+
+  auto allocate(std::size_t n) -> T*
+  {
+    ++log->allocations;
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T* pointer, std::size_t n) noexcept
+  {
+    ++log->deallocations;
+    std::allocator<T>{}.deallocate(pointer, n);
+  }
+
+  template <typename U>
+  auto operator==(const LoggingAllocator<U>& other) const noexcept -> bool
+  {
+    return log == other.log;
+  }
+};
+
+// GCC matches operator new/delete pairs by their mangled names and treats the
+// member template operator new taking `std::allocator_arg` as mismatched with
+// the promise's sized operator delete, which is the one every coroutine frame
+// is released through. Both go through the same FrameDeallocator trailer.
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+auto allocatedLeaf(
+    std::allocator_arg_t, LoggingAllocator<int> alloc, int x)
+    -> Either<int, std::string>
+{
+  (void)alloc;
+  if (x < 0)
+    co_return std::string("negative");
+  co_return x * 2;
+}
+
+auto allocatedChain(
+    std::allocator_arg_t, LoggingAllocator<int> alloc, int x)
+    -> Either<int, std::string>
+{
+  int doubled = co_await allocatedLeaf(std::allocator_arg, alloc, x);
+  co_return doubled + 1;
+}
+
+auto pmrLeaf(
+    std::allocator_arg_t, std::pmr::polymorphic_allocator<> alloc, int x)
+    -> Either<int, std::string>
+{
+  (void)alloc;
+  co_return x + 1;
+}
+
+struct Handler
+{
+  int offset;
+
+  auto handle(std::allocator_arg_t, LoggingAllocator<int> alloc, int x)
+      -> Either<int, std::string>
+  {
+    (void)alloc;
+    co_return x + offset;
+  }
+};
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic pop
+#endif
+} // namespace
+
+TEST(EitherFrameAllocator, UNIT_032_AllocatorArgPlacesFrame)
+{
+  RecordProperty("id", "0.01-UNIT-032");
+  RecordProperty(
+      "desc", "Frames are placed with the allocator after allocator_arg");
+
+  AllocationLog log;
+  {
+    auto result =
+        allocatedChain(std::allocator_arg, LoggingAllocator<int>{&log}, 20);
+    ASSERT_TRUE(result.data());
+    EXPECT_EQ(*result.data(), 41);
+  }
+  EXPECT_EQ(log.allocations, 2);
+  EXPECT_EQ(log.deallocations, 2);
+
+  {
+    auto result =
+        allocatedChain(std::allocator_arg, LoggingAllocator<int>{&log}, -1);
+    ASSERT_TRUE(result.error());
+    EXPECT_EQ(*result.error(), "negative");
+  }
+  EXPECT_EQ(log.allocations, 4);
+  EXPECT_EQ(log.deallocations, 4);
+}
+
+TEST(EitherFrameAllocator, UNIT_033_MemberCoroutine)
+{
+  RecordProperty("id", "0.01-UNIT-033");
+  RecordProperty("desc", "allocator_arg is honoured on member coroutines");
+
+  AllocationLog log;
+  Handler handler{.offset = 7};
+  {
+    auto result =
+        handler.handle(std::allocator_arg, LoggingAllocator<int>{&log}, 3);
+    ASSERT_TRUE(result.data());
+    EXPECT_EQ(*result.data(), 10);
+  }
+  EXPECT_EQ(log.allocations, 1);
+  EXPECT_EQ(log.deallocations, 1);
+}
+
+TEST(EitherFrameAllocator, UNIT_034_BumpAllocatorBuffer)
+{
+  RecordProperty("id", "0.01-UNIT-034");
+  RecordProperty("desc", "Frames come from a caller-provided bump buffer");
+
+  alignas(std::max_align_t) std::array<std::byte, 4096> buffer{};
+  std::pmr::monotonic_buffer_resource arena{
+      buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+  CountingResource counting{&arena};
+
+  for (int i = 0; i < 4; ++i)
+  {
+    auto result = pmrLeaf(std::allocator_arg, &counting, i);
+    ASSERT_TRUE(result.data());
+    EXPECT_EQ(*result.data(), i + 1);
+  }
+  EXPECT_EQ(counting.allocations, 4);
+}
+// NOLINTEND(readability-magic-numbers)
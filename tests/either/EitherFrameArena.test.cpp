@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <array>
+#include <cstddef>
+#include <gtest/gtest.h>
+
+#include "TestHelpers.hpp"
+
+// NOLINTBEGIN(readability-magic-numbers)
+TEST(EitherFrameArena, UNIT_035_FramesFromActiveArena)
+{
+  RecordProperty("id", "0.01-UNIT-035");
+  RecordProperty(
+      "desc", "Nested frames are bump-allocated from the active FrameArena");
+
+  EXPECT_EQ(FrameArena::active(), nullptr);
+  {
+    FrameArena arena;
+    EXPECT_EQ(FrameArena::active(), &arena);
+
+    auto success = level1(0);
+    ASSERT_TRUE(success.data());
+    EXPECT_EQ(*success.data(), 5);
+
+    auto failure = level1Error();
+    ASSERT_TRUE(failure.error());
+    EXPECT_EQ(*failure.error(), "deep error");
+
+    EXPECT_GT(arena.bytesAllocated(), 0U);
+  }
+  EXPECT_EQ(FrameArena::active(), nullptr);
+}
+
+TEST(EitherFrameArena, UNIT_036_NestedArenas)
+{
+  RecordProperty("id", "0.01-UNIT-036");
+  RecordProperty("desc", "Innermost arena wins and outer one is restored");
+
+  FrameArena outer;
+  {
+    FrameArena inner;
+    EXPECT_EQ(FrameArena::active(), &inner);
+    auto result = returnData(1);
+    EXPECT_GT(inner.bytesAllocated(), 0U);
+    EXPECT_EQ(outer.bytesAllocated(), 0U);
+  }
+  EXPECT_EQ(FrameArena::active(), &outer);
+  auto result = returnData(2);
+  EXPECT_GT(outer.bytesAllocated(), 0U);
+}
+
+TEST(EitherFrameArena, UNIT_037_CallerBufferAndGrowth)
+{
+  RecordProperty("id", "0.01-UNIT-037");
+  RecordProperty(
+      "desc", "Arena fills the caller buffer first and then grows on heap");
+
+  alignas(std::max_align_t) std::array<std::byte, 256> buffer{};
+  FrameArena arena{buffer.data(), buffer.size()};
+
+  void* first = arena.allocate(64);
+  EXPECT_EQ(first, buffer.data());
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    auto result = chainedAwaitsAllSucceed(i);
+    ASSERT_TRUE(result.data());
+    EXPECT_EQ(*result.data(), i + 110);
+  }
+  EXPECT_GT(arena.bytesAllocated(), buffer.size());
+}
+// NOLINTEND(readability-magic-numbers)
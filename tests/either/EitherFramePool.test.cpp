@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "TestHelpers.hpp"
+
+#if ROPIC_FRAME_POOL
+using ropic::detail::FramePool;
+
+// NOLINTBEGIN(readability-magic-numbers)
+// With the frame stack enabled, synchronous frames bypass the pool
+#if !ROPIC_FRAME_STACK
+TEST(EitherFramePool, UNIT_029_FramesReturnToPool)
+{
+  RecordProperty("id", "0.01-UNIT-029");
+  RecordProperty("desc", "Completed coroutine frames are cached for reuse");
+
+  FramePool::local().release();
+  ASSERT_EQ(FramePool::local().cachedBlocks(), 0U);
+
+  {
+    auto result = level1(0);
+    ASSERT_TRUE(result.data());
+    EXPECT_EQ(*result.data(), 5);
+  }
+  const std::size_t cached = FramePool::local().cachedBlocks();
+  EXPECT_GT(cached, 0U);
+
+  // A warm pool serves the same chain without growing
+  for (int i = 0; i < 100; ++i)
+  {
+    auto result = level1(i);
+    ASSERT_TRUE(result.data());
+    EXPECT_EQ(*result.data(), i + 5);
+  }
+  EXPECT_EQ(FramePool::local().cachedBlocks(), cached);
+
+  FramePool::local().release();
+  EXPECT_EQ(FramePool::local().cachedBlocks(), 0U);
+}
+#endif
+
+TEST(EitherFramePool, UNIT_030_BlockReuse)
+{
+  RecordProperty("id", "0.01-UNIT-030");
+  RecordProperty("desc", "Same size class hands back the last freed block");
+
+  auto& pool = FramePool::local();
+  void* first = pool.allocate(100);
+  pool.deallocate(first, 100);
+  void* second = pool.allocate(110);
+  EXPECT_EQ(first, second);
+  pool.deallocate(second, 110);
+
+  void* large = pool.allocate(FramePool::MAX_POOLED_SIZE + 1);
+  ASSERT_NE(large, nullptr);
+  pool.deallocate(large, FramePool::MAX_POOLED_SIZE + 1);
+  pool.release();
+}
+
+TEST(EitherFramePool, UNIT_031_ErrorPathAndOtherThreads)
+{
+  RecordProperty("id", "0.01-UNIT-031");
+  RecordProperty(
+      "desc", "Frames destroyed on error propagation or on another thread");
+
+  for (int i = 0; i < 100; ++i)
+  {
+    auto error = level1Error();
+    ASSERT_TRUE(error.error());
+    EXPECT_EQ(*error.error(), "deep error");
+  }
+
+  std::thread worker(
+      []
+      {
+        auto result = chainedAwaitsAllSucceed(1);
+        EXPECT_EQ(*result.data(), 111);
+      });
+  worker.join();
+  SUCCEED();
+}
+
+TEST(EitherFramePool, UNIT_053_RemoteFreeReturnsToOwner)
+{
+  RecordProperty("id", "0.01-UNIT-053");
+  RecordProperty(
+      "desc", "A block freed on another thread is reused by its owner");
+
+  auto& pool = FramePool::local();
+  pool.release();
+  void* block = pool.allocate(200);
+
+  std::thread remote([block] { FramePool::deallocateFrame(block, 200); });
+  remote.join();
+  EXPECT_EQ(pool.cachedBlocks(), 0U);
+
+  // The empty free list drains the remote queue first
+  void* reused = pool.allocate(200);
+  EXPECT_EQ(reused, block);
+  pool.deallocate(reused, 200);
+  EXPECT_EQ(pool.cachedBlocks(), 1U);
+  pool.release();
+}
+
+TEST(EitherFramePool, UNIT_054_BlocksOutliveTheirThread)
+{
+  RecordProperty("id", "0.01-UNIT-054");
+  RecordProperty(
+      "desc", "Blocks of an exited thread are freed safely anywhere");
+
+  std::vector<void*> blocks;
+  std::thread owner(
+      [&blocks]
+      {
+        for (int i = 0; i < 4; ++i)
+          blocks.push_back(FramePool::allocateFrame(64));
+        FramePool::deallocateFrame(blocks.back(), 64);
+        blocks.pop_back();
+      });
+  owner.join();
+
+  const std::size_t cached = FramePool::local().cachedBlocks();
+  FramePool::deallocateFrame(blocks[0], 64);
+  std::thread other([&blocks] { FramePool::deallocateFrame(blocks[1], 64); });
+  other.join();
+  FramePool::deallocateFrame(blocks[2], 64);
+  EXPECT_EQ(FramePool::local().cachedBlocks(), cached);
+}
+#if !ROPIC_FRAME_STACK
+TEST(EitherFramePool, UNIT_057_ReserveFramesPrewarmsPool)
+{
+  RecordProperty("id", "0.01-UNIT-057");
+  RecordProperty(
+      "desc", "reserveFrames() caches blocks that first frames then reuse");
+
+  auto& pool = FramePool::local();
+  pool.release();
+
+  const FrameReservation reservation = reserveFrames(4, 256);
+  EXPECT_GT(reservation.blocks, 0U);
+  EXPECT_EQ(reservation.blocks % 4, 0U);
+  EXPECT_GE(reservation.bytes, reservation.blocks * 256 / 2);
+  EXPECT_EQ(pool.cachedBlocks(), reservation.blocks);
+
+  // Already warm: nothing left to reserve
+  const FrameReservation again = reserveFrames(4, 256);
+  EXPECT_EQ(again.blocks, 0U);
+  EXPECT_EQ(again.bytes, 0U);
+
+  // A chain of small frames is served without new blocks
+  auto result = level1(0);
+  ASSERT_TRUE(result.data());
+  EXPECT_EQ(pool.cachedBlocks(), reservation.blocks);
+  pool.release();
+}
+#endif
+// NOLINTEND(readability-magic-numbers)
+#endif
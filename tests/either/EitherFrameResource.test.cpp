@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+#include "TestHelpers.hpp"
+
+// NOLINTBEGIN(readability-magic-numbers)
+namespace
+{
+auto collectSquares(int count) -> Either<std::pmr::vector<int>, std::string>
+{
+  if (count < 0)
+    co_return std::string("negative count");
+
+  std::pmr::vector<int> squares{currentFrameResource()};
+  for (int i = 0; i < count; ++i)
+    squares.push_back(i * i);
+  co_return std::move(squares);
+}
+
+auto sumSquares(int count) -> Either<int, std::string>
+{
+  std::pmr::vector<int> squares = co_await collectSquares(count);
+  int sum = 0;
+  for (int square : squares)
+    sum += square;
+  co_return sum;
+}
+} // namespace
+
+TEST(EitherFrameResource, UNIT_038_ScopedResource)
+{
+  RecordProperty("id", "0.01-UNIT-038");
+  RecordProperty(
+      "desc", "FrameResourceScope routes frames to the memory resource");
+
+  CountingResource counting;
+  EXPECT_EQ(currentFrameResource(), nullptr);
+  {
+    FrameResourceScope scope{&counting};
+    EXPECT_EQ(currentFrameResource(), &counting);
+
+    auto result = level1(0);
+    ASSERT_TRUE(result.data());
+    EXPECT_EQ(*result.data(), 5);
+    EXPECT_EQ(counting.allocations, 5);
+    EXPECT_EQ(counting.deallocations, 5);
+  }
+  EXPECT_EQ(currentFrameResource(), nullptr);
+
+  auto outside = level1(0);
+  EXPECT_EQ(counting.allocations, 5);
+}
+
+TEST(EitherFrameResource, UNIT_039_GlobalAndThreadResources)
+{
+  RecordProperty("id", "0.01-UNIT-039");
+  RecordProperty(
+      "desc", "Thread resource overrides the process-wide resource");
+
+  CountingResource global;
+  CountingResource local;
+  EXPECT_EQ(setGlobalFrameResource(&global), nullptr);
+
+  std::thread worker(
+      []
+      {
+        auto result = returnData(1);
+        EXPECT_TRUE(result.data());
+      });
+  worker.join();
+  EXPECT_EQ(global.allocations, 1);
+
+  EXPECT_EQ(setThreadFrameResource(&local), nullptr);
+  auto result = returnData(2);
+  EXPECT_EQ(local.allocations, 1);
+  EXPECT_EQ(global.allocations, 1);
+
+  EXPECT_EQ(setThreadFrameResource(nullptr), &local);
+  EXPECT_EQ(setGlobalFrameResource(nullptr), &global);
+}
+
+TEST(EitherFrameResource, UNIT_040_SharedWithPmrPayload)
+{
+  RecordProperty("id", "0.01-UNIT-040");
+  RecordProperty("desc", "Frames and pmr payloads share one resource");
+
+  CountingResource counting;
+  FrameResourceScope scope{&counting};
+
+  auto sum = sumSquares(4);
+  ASSERT_TRUE(sum.data());
+  EXPECT_EQ(*sum.data(), 14);
+  // Two frames plus the vector's growth steps
+  EXPECT_GT(counting.allocations, 2);
+  EXPECT_EQ(counting.allocations, counting.deallocations);
+
+  auto failure = sumSquares(-1);
+  ASSERT_TRUE(failure.error());
+  EXPECT_EQ(*failure.error(), "negative count");
+}
+
+TEST(EitherFrameResource, UNIT_041_StandardResources)
+{
+  RecordProperty("id", "0.01-UNIT-041");
+  RecordProperty("desc", "Standard pmr resources back recursive chains");
+
+  std::pmr::synchronized_pool_resource synchronizedPool;
+  std::pmr::unsynchronized_pool_resource unsynchronizedPool;
+  std::pmr::monotonic_buffer_resource monotonic;
+
+  for (std::pmr::memory_resource* resource :
+       {static_cast<std::pmr::memory_resource*>(&synchronizedPool),
+        static_cast<std::pmr::memory_resource*>(&unsynchronizedPool),
+        static_cast<std::pmr::memory_resource*>(&monotonic)})
+  {
+    FrameResourceScope scope{resource};
+    auto success = level1(10);
+    ASSERT_TRUE(success.data());
+    EXPECT_EQ(*success.data(), 15);
+
+    auto failure = level1Error();
+    ASSERT_TRUE(failure.error());
+    EXPECT_EQ(*failure.error(), "deep error");
+  }
+}
+// NOLINTEND(readability-magic-numbers)
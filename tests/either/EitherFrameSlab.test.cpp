@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <cstdint>
+#include <gtest/gtest.h>
+
+#include "TestHelpers.hpp"
+
+using ropic::detail::FrameSlab;
+using ropic::detail::SlabBacking;
+
+// NOLINTBEGIN(readability-magic-numbers)
+TEST(EitherFrameSlab, UNIT_055_ReserveWithFallback)
+{
+  RecordProperty("id", "0.01-UNIT-055");
+  RecordProperty(
+      "desc", "A slab is always reserved, huge pages or not, and is usable");
+
+  FrameSlab* second = FrameSlab::reserve(nullptr);
+  FrameSlab* first = FrameSlab::reserve(second);
+  for (FrameSlab* slab : {first, second})
+  {
+    ASSERT_NE(slab, nullptr);
+    EXPECT_EQ(
+        reinterpret_cast<std::uintptr_t>(slab->begin()) % alignof(FrameSlab),
+        0U);
+    EXPECT_EQ(
+        static_cast<std::size_t>(slab->end() - slab->begin()),
+        FrameSlab::SIZE - sizeof(FrameSlab));
+    if (slab->backing() == SlabBacking::ADVISED)
+    {
+      EXPECT_EQ(
+          reinterpret_cast<std::uintptr_t>(slab) % FrameSlab::HUGE_PAGE_SIZE,
+          0U);
+    }
+
+    *slab->begin() = std::byte{1};
+    *(slab->end() - 1) = std::byte{2};
+    EXPECT_EQ(*slab->begin(), std::byte{1});
+  }
+  FrameSlab::releaseAll(first);
+}
+
+#if ROPIC_FRAME_HUGE_PAGES && ROPIC_FRAME_POOL
+using ropic::detail::FramePool;
+
+TEST(EitherFrameSlab, UNIT_056_PoolCarvesBlocksFromSlabs)
+{
+  RecordProperty("id", "0.01-UNIT-056");
+  RecordProperty("desc", "Fresh pool blocks are packed next to each other");
+
+  auto& pool = FramePool::local();
+  pool.release();
+  void* first = pool.allocate(64);
+  void* second = pool.allocate(64);
+  void* third = pool.allocate(64);
+  const auto stride =
+      static_cast<std::byte*>(second) - static_cast<std::byte*>(first);
+  const auto maxStride =
+      64 + 2 * static_cast<std::ptrdiff_t>(FramePool::GRANULARITY);
+  EXPECT_GT(stride, 64);
+  EXPECT_LE(stride, maxStride);
+  EXPECT_EQ(
+      static_cast<std::byte*>(third) - static_cast<std::byte*>(second),
+      stride);
+
+  pool.deallocate(third, 64);
+  pool.deallocate(second, 64);
+  pool.deallocate(first, 64);
+  EXPECT_EQ(pool.allocate(64), first);
+  pool.deallocate(first, 64);
+  pool.release();
+  EXPECT_EQ(pool.cachedBlocks(), 0U);
+}
+#endif
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <coroutine>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "TestHelpers.hpp"
+
+using ropic::detail::FrameStack;
+
+// NOLINTBEGIN(readability-magic-numbers)
+TEST(EitherFrameStack, UNIT_048_LifoReuse)
+{
+  RecordProperty("id", "0.01-UNIT-048");
+  RecordProperty("desc", "Frames released in LIFO order move the stack back");
+
+  FrameStack stack{1024};
+  void* first = stack.allocate(100);
+  void* second = stack.allocate(40);
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+  EXPECT_GT(static_cast<std::byte*>(second), static_cast<std::byte*>(first));
+  EXPECT_EQ(
+      reinterpret_cast<std::uintptr_t>(second) % FrameStack::ALIGNMENT, 0U);
+
+  stack.release(second);
+  stack.release(first);
+  EXPECT_EQ(stack.bytesInUse(), 0U);
+  void* again = stack.allocate(100);
+  EXPECT_EQ(again, first);
+  stack.release(again);
+}
+
+TEST(EitherFrameStack, UNIT_049_OutOfOrderRelease)
+{
+  RecordProperty("id", "0.01-UNIT-049");
+  RecordProperty(
+      "desc", "A frame released out of order is reclaimed once uncovered");
+
+  FrameStack stack{1024};
+  void* bottom = stack.allocate(64);
+  const std::size_t bottomBytes = stack.bytesInUse();
+  void* middle = stack.allocate(64);
+  void* top = stack.allocate(64);
+  const std::size_t allBytes = stack.bytesInUse();
+
+  stack.release(middle);
+  EXPECT_EQ(stack.bytesInUse(), allBytes);
+
+  stack.release(top);
+  EXPECT_EQ(stack.bytesInUse(), bottomBytes);
+
+  stack.release(bottom);
+  EXPECT_EQ(stack.bytesInUse(), 0U);
+}
+
+TEST(EitherFrameStack, UNIT_050_FullStackFallsBack)
+{
+  RecordProperty("id", "0.01-UNIT-050");
+  RecordProperty("desc", "Frames that do not fit are refused, not truncated");
+
+  FrameStack stack{256};
+  EXPECT_EQ(stack.allocate(1000), nullptr);
+
+  void* frame = stack.allocate(100);
+  ASSERT_NE(frame, nullptr);
+  EXPECT_EQ(stack.allocate(200), nullptr);
+  stack.release(frame);
+  EXPECT_EQ(stack.bytesInUse(), 0U);
+}
+
+TEST(EitherFrameStack, UNIT_051_ReleaseFromOtherThread)
+{
+  RecordProperty("id", "0.01-UNIT-051");
+  RecordProperty(
+      "desc", "A frame freed on another thread is reclaimed by its owner");
+
+  FrameStack& stack = FrameStack::local();
+  const std::size_t before = stack.bytesInUse();
+  void* frame = FrameStack::allocateFrame(128);
+  ASSERT_NE(frame, nullptr);
+
+  std::thread other([frame] { FrameStack::deallocateFrame(frame); });
+  other.join();
+
+  void* next = FrameStack::allocateFrame(128);
+  EXPECT_EQ(next, frame);
+  FrameStack::deallocateFrame(next);
+  EXPECT_EQ(stack.bytesInUse(), before);
+}
+
+#if ROPIC_FRAME_STACK
+namespace
+{
+auto parkedLeaf(std::coroutine_handle<>* parked) -> Either<int, TestError>
+{
+  co_await ParkingAwaitable{parked};
+  co_return 7;
+}
+} // namespace
+
+TEST(EitherFrameStack, UNIT_052_SuspendedFramePinsItsSlot)
+{
+  RecordProperty("id", "0.01-UNIT-052");
+  RecordProperty(
+      "desc", "A suspended frame outlives its caller without blocking others");
+
+  FrameStack& stack = FrameStack::local();
+  const std::size_t before = stack.bytesInUse();
+
+  std::coroutine_handle<> parked;
+  auto pending = parkedLeaf(&parked);
+  ASSERT_FALSE(pending.done());
+  const std::size_t pinned = stack.bytesInUse();
+  EXPECT_GT(pinned, before);
+
+  for (int i = 0; i < 10; ++i)
+  {
+    auto result = level1(i);
+    ASSERT_TRUE(result.data());
+    EXPECT_EQ(*result.data(), i + 5);
+    EXPECT_EQ(stack.bytesInUse(), pinned);
+  }
+
+  parked.resume();
+  ASSERT_TRUE(pending.data());
+  EXPECT_EQ(*pending.data(), 7);
+  EXPECT_EQ(stack.bytesInUse(), before);
+}
+
+TEST(EitherFrameStack, UNIT_058_ReserveFramesCommitsStack)
+{
+  RecordProperty("id", "0.01-UNIT-058");
+  RecordProperty("desc", "reserveFrames() commits the frame stack once");
+
+  std::size_t stackBytes = 0;
+  std::thread worker(
+      [&stackBytes]
+      {
+        stackBytes = reserveFrames(0).bytes;
+        EXPECT_EQ(reserveFrames(0).bytes, 0U);
+      });
+  worker.join();
+  EXPECT_EQ(stackBytes, FrameStack::DEFAULT_CAPACITY);
+}
+#endif
+// NOLINTEND(readability-magic-numbers)
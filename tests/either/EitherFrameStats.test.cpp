@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <gtest/gtest.h>
+#include <numeric>
+
+#include "TestHelpers.hpp"
+
+// NOLINTBEGIN(readability-magic-numbers)
+namespace
+{
+/// Instantiation used only by this file so its counters are predictable.
+auto statsLeaf(long x) -> Either<long, TestError>
+{
+  if (x < 0)
+    co_return TestError{.code = 1, .message = "negative"};
+  co_return x + 1;
+}
+
+auto statsChain(long x) -> Either<long, TestError>
+{
+  long value = co_await statsLeaf(x);
+  co_return value * 2;
+}
+
+auto findStats(const StatsSnapshot& snapshot) -> const FrameStats*
+{
+  for (const auto& entry : snapshot.perType)
+  {
+    if (entry.type.find("TestError") != std::string_view::npos
+        && entry.type.find("long") != std::string_view::npos)
+      return &entry;
+  }
+  return nullptr;
+}
+} // namespace
+
+#if ROPIC_FRAME_STATS
+TEST(EitherFrameStats, UNIT_042_PerInstantiationCounters)
+{
+  RecordProperty("id", "0.01-UNIT-042");
+  RecordProperty(
+      "desc", "Frames are counted per Either<DATA, ERROR> instantiation");
+
+  resetStats();
+  for (long i = 0; i < 10; ++i)
+  {
+    auto result = statsChain(i);
+    ASSERT_TRUE(result.data());
+    EXPECT_EQ(*result.data(), (i + 1) * 2);
+  }
+  auto failure = statsChain(-1);
+  ASSERT_TRUE(failure.error());
+
+  const StatsSnapshot snapshot = stats();
+  const FrameStats* entry = findStats(snapshot);
+  ASSERT_NE(entry, nullptr);
+
+  EXPECT_EQ(entry->coroutinesStarted, 22U);
+  EXPECT_EQ(entry->framesAllocated + entry->framesElided(), 22U);
+  EXPECT_EQ(entry->framesFreed, entry->framesAllocated);
+  EXPECT_EQ(entry->liveBytes, 0U);
+  EXPECT_EQ(
+      std::accumulate(
+          entry->sizeHistogram.begin(), entry->sizeHistogram.end(),
+          std::uint64_t{0}),
+      entry->framesAllocated);
+  if (entry->framesAllocated > 0)
+  {
+    EXPECT_GT(entry->bytesAllocated, 0U);
+    EXPECT_GT(entry->peakLiveBytes, 0U);
+    EXPECT_LE(entry->peakLiveBytes, entry->bytesAllocated);
+  }
+}
+
+TEST(EitherFrameStats, UNIT_043_TotalsAndReset)
+{
+  RecordProperty("id", "0.01-UNIT-043");
+  RecordProperty("desc", "Totals aggregate every instantiation; reset clears");
+
+  resetStats();
+  {
+    auto result = level1(0);
+    auto other = statsChain(1);
+    ASSERT_TRUE(result.data());
+    ASSERT_TRUE(other.data());
+  }
+
+  const StatsSnapshot snapshot = stats();
+  std::uint64_t started = 0;
+  for (const auto& entry : snapshot.perType)
+    started += entry.coroutinesStarted;
+  EXPECT_EQ(snapshot.total.coroutinesStarted, started);
+  EXPECT_EQ(snapshot.total.coroutinesStarted, 7U);
+  EXPECT_EQ(snapshot.total.framesFreed, snapshot.total.framesAllocated);
+
+  resetStats();
+  const StatsSnapshot cleared = stats();
+  EXPECT_EQ(cleared.total.coroutinesStarted, 0U);
+  EXPECT_EQ(cleared.total.framesAllocated, 0U);
+}
+#else
+TEST(EitherFrameStats, UNIT_042_CompiledOut)
+{
+  RecordProperty("id", "0.01-UNIT-042");
+  RecordProperty("desc", "stats() is empty when ROPIC_FRAME_STATS is 0");
+
+  auto result = statsChain(1);
+  ASSERT_TRUE(result.data());
+  EXPECT_TRUE(stats().perType.empty());
+  EXPECT_EQ(findStats(stats()), nullptr);
+}
+#endif
+// NOLINTEND(readability-magic-numbers)
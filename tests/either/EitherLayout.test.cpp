@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string>
+#include <variant>
+
+#include "TestHelpers.hpp"
+
+// NOLINTBEGIN(readability-magic-numbers)
+namespace
+{
+enum class ErrorCode : std::uint8_t
+{
+  FAILED,
+};
+
+/// Layout with the coroutine handle stored next to the result.
+template <typename DATA, typename ERROR>
+struct SeparateHandleLayout
+{
+  void* handle;
+  std::variant<std::monostate, DATA, ERROR> result;
+};
+
+/// Bytes saved by sharing the handle's storage with the result.
+template <typename DATA, typename ERROR>
+constexpr std::size_t SAVED_BYTES =
+    sizeof(SeparateHandleLayout<DATA, ERROR>) - sizeof(Either<DATA, ERROR>);
+
+/// Either costs no more than a variant of a pointer, DATA and ERROR.
+template <typename DATA, typename ERROR>
+constexpr bool FOLDS_HANDLE =
+    sizeof(Either<DATA, ERROR>) <= sizeof(std::variant<void*, DATA, ERROR>);
+
+/// Either is its largest member plus a one-byte tag, rounded to alignment.
+template <typename DATA, typename ERROR>
+constexpr bool IS_TAGGED_UNION =
+    sizeof(Either<DATA, ERROR>)
+    == (std::max({sizeof(void*), sizeof(DATA), sizeof(ERROR)}) + 1
+        + alignof(Either<DATA, ERROR>) - 1)
+           / alignof(Either<DATA, ERROR>) * alignof(Either<DATA, ERROR>);
+
+// =============================================================================
+// Size table
+// =============================================================================
+static_assert(FOLDS_HANDLE<int, ErrorCode>);
+static_assert(FOLDS_HANDLE<int, std::string>);
+static_assert(FOLDS_HANDLE<int, TestError>);
+static_assert(FOLDS_HANDLE<Void, TestError>);
+static_assert(FOLDS_HANDLE<TestData, TestError>);
+static_assert(FOLDS_HANDLE<LargeStruct, std::string>);
+
+// Payloads of at least pointer alignment save a whole pointer
+static_assert(SAVED_BYTES<int, std::string> == sizeof(void*));
+static_assert(SAVED_BYTES<int, TestError> == sizeof(void*));
+static_assert(SAVED_BYTES<Void, TestError> == sizeof(void*));
+static_assert(SAVED_BYTES<TestData, TestError> == sizeof(void*));
+static_assert(SAVED_BYTES<LargeStruct, std::string> == sizeof(void*));
+
+// Payloads smaller than a pointer are dominated by the handle itself, unless
+// they opt in to sharing its word (see EitherNiche)
+static_assert(sizeof(Either<int, ErrorCode>) == 2 * sizeof(void*));
+static_assert(sizeof(Either<Void, ErrorCode>) == 2 * sizeof(void*));
+
+// One tag byte on top of the largest member, no wider index
+static_assert(IS_TAGGED_UNION<int, ErrorCode>);
+static_assert(IS_TAGGED_UNION<int, std::string>);
+static_assert(IS_TAGGED_UNION<Void, TestError>);
+static_assert(IS_TAGGED_UNION<LargeStruct, std::string>);
+} // namespace
+
+TEST(EitherLayout, UNIT_059_SizeTable)
+{
+  RecordProperty("id", "0.01-UNIT-059");
+  RecordProperty(
+      "desc", "The coroutine handle shares storage with the result");
+  RecordProperty(
+      "sizeof(Either<int, std::string>)",
+      static_cast<int>(sizeof(Either<int, std::string>)));
+  RecordProperty(
+      "sizeof(Either<int, TestError>)",
+      static_cast<int>(sizeof(Either<int, TestError>)));
+
+  Either<int, std::string> value{42};
+  EXPECT_TRUE(value.done());
+
+  Either<int, std::string> moved{std::move(value)};
+  EXPECT_TRUE(moved.done());
+  EXPECT_FALSE(value.done()); // NOLINT(bugprone-use-after-move)
+  EXPECT_FALSE(value.data());
+  EXPECT_FALSE(value.error());
+}
+// NOLINTEND(readability-magic-numbers)
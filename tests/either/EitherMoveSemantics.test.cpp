@@ -2,6 +2,7 @@
 // Copyright (c) 2025 ropic contributors
 
 #include <gtest/gtest.h>
+#include <vector>
 
 #include "TestHelpers.hpp"
 
@@ -137,4 +138,31 @@ TEST(EitherMoveSemantics, UNIT_010_ZeroCopies)
   ASSERT_TRUE(errDst.error());
   EXPECT_EQ(errDst.error()->value, -1);
 }
+
+TEST(EitherMoveSemantics, UNIT_072_TakeDataAndError)
+{
+  RecordProperty("id", "0.01-UNIT-072");
+  RecordProperty(
+      "desc", "takeData/takeError move the payload out and empty the Either");
+
+  MoveTracker::reset();
+  auto data = returnMoveTrackerInPlace(8);
+  MoveTracker taken = std::move(data).takeData();
+  EXPECT_EQ(taken.value, 8);
+  EXPECT_EQ(MoveTracker::s_moveCount, 1);
+  EXPECT_EQ(MoveTracker::s_copyCount, 0);
+  EXPECT_FALSE(data.done()); // NOLINT(bugprone-use-after-move)
+  EXPECT_FALSE(data.data());
+
+  auto error = returnMoveTrackerErrorInPlace(-8);
+  MoveTracker takenError = std::move(error).takeError();
+  EXPECT_EQ(takenError.value, -8);
+  EXPECT_FALSE(error.done()); // NOLINT(bugprone-use-after-move)
+  EXPECT_FALSE(error.error());
+
+  std::vector<int> values =
+      Either<std::vector<int>, std::string>{std::vector<int>{1, 2, 3}}
+          .takeData();
+  EXPECT_EQ(values.size(), 3U);
+}
 // NOLINTEND(readability-magic-numbers)
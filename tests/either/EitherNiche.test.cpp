@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <coroutine>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+
+#include "TestHelpers.hpp"
+
+// NOLINTBEGIN(readability-magic-numbers)
+namespace
+{
+struct Node
+{
+  static int s_destroyed;
+  int key;
+
+  Node(const Node&) = delete;
+  Node(Node&&) = delete;
+  auto operator=(const Node&) -> Node& = delete;
+  auto operator=(Node&&) -> Node& = delete;
+  explicit Node(int k) : key(k) {}
+  ~Node() { ++s_destroyed; }
+};
+
+int Node::s_destroyed = 0;
+
+/// Pointee without a niche_traits opt-in.
+struct Unlisted
+{
+  int key;
+};
+
+enum class LookupError : std::uint8_t
+{
+  NOT_FOUND,
+  EXPIRED,
+};
+
+/// Small error without a pack_inline opt-in.
+enum class Unpacked : std::uint8_t
+{
+  FAILED,
+};
+} // namespace
+
+template <>
+struct ropic::niche_traits<Node*> : ropic::pointer_niche<Node>
+{
+};
+
+template <>
+struct ropic::niche_traits<std::unique_ptr<Node>> : ropic::pointer_niche<Node>
+{
+};
+
+template <>
+struct ropic::pack_inline<LookupError> : std::true_type
+{
+};
+
+namespace
+{
+static_assert(sizeof(Either<Node*, LookupError>) == sizeof(void*));
+static_assert(sizeof(Either<std::unique_ptr<Node>, LookupError>)
+              == sizeof(void*));
+static_assert(sizeof(Either<int, std::unique_ptr<Node>>) == sizeof(void*));
+static_assert(sizeof(Either<Unlisted*, LookupError>) == 2 * sizeof(void*));
+static_assert(sizeof(Either<Node*, std::unique_ptr<Node>>)
+              == 2 * sizeof(void*));
+
+// Small payloads share the handle's word only once one of them opts in
+static_assert(sizeof(Either<Void, LookupError>) == sizeof(void*));
+static_assert(sizeof(Either<std::int32_t, LookupError>) == sizeof(void*));
+static_assert(sizeof(Either<std::int32_t, Unpacked>) == 2 * sizeof(void*));
+static_assert(sizeof(Either<Void, Unpacked>) == 2 * sizeof(void*));
+
+auto find(Node* table, int key) -> Either<Node*, LookupError>
+{
+  if (key < 0)
+    co_return LookupError::NOT_FOUND;
+  if (key == 0)
+    co_return static_cast<Node*>(nullptr);
+  co_return table;
+}
+
+auto findKey(Node* table, int key) -> Either<int, LookupError>
+{
+  Node* node = co_await find(table, key);
+  co_return node ? node->key : -1;
+}
+
+auto make(int key) -> Either<std::unique_ptr<Node>, LookupError>
+{
+  if (key < 0)
+    co_return LookupError::EXPIRED;
+  co_return std::make_unique<Node>(key);
+}
+
+auto parkedFind(std::coroutine_handle<>* parked, Node* table)
+    -> Either<Node*, LookupError>
+{
+  co_await ParkingAwaitable{parked};
+  co_return table;
+}
+} // namespace
+
+TEST(EitherNiche, UNIT_060_PointerCarrier)
+{
+  RecordProperty("id", "0.01-UNIT-060");
+  RecordProperty(
+      "desc", "Opted-in pointers keep data, error and null data distinct");
+
+  Node table{42};
+
+  auto found = find(&table, 1);
+  ASSERT_TRUE(found.data());
+  EXPECT_EQ(*found.data(), &table);
+  EXPECT_FALSE(found.error());
+
+  auto null = find(&table, 0);
+  ASSERT_TRUE(null.done());
+  ASSERT_TRUE(null.data());
+  EXPECT_EQ(*null.data(), nullptr);
+
+  auto missing = find(&table, -1);
+  ASSERT_TRUE(missing.error());
+  EXPECT_EQ(*missing.error(), LookupError::NOT_FOUND);
+  EXPECT_FALSE(missing.data());
+
+  EXPECT_EQ(*findKey(&table, 1).data(), 42);
+  EXPECT_EQ(*findKey(&table, 0).data(), -1);
+  EXPECT_EQ(*findKey(&table, -1).error(), LookupError::NOT_FOUND);
+}
+
+TEST(EitherNiche, UNIT_061_OwningCarrier)
+{
+  RecordProperty("id", "0.01-UNIT-061");
+  RecordProperty(
+      "desc", "A niche-carrying unique_ptr is moved and destroyed once");
+
+  Node::s_destroyed = 0;
+  {
+    auto made = make(7);
+    ASSERT_TRUE(made.data());
+    EXPECT_EQ((*made.data())->key, 7);
+
+    Either<std::unique_ptr<Node>, LookupError> moved{std::move(made)};
+    ASSERT_TRUE(moved.data());
+    EXPECT_EQ((*moved.data())->key, 7);
+    EXPECT_FALSE(made.done()); // NOLINT(bugprone-use-after-move)
+
+    moved = make(-1);
+    EXPECT_EQ(Node::s_destroyed, 1);
+    ASSERT_TRUE(moved.error());
+    EXPECT_EQ(*moved.error(), LookupError::EXPIRED);
+
+    Either<int, std::unique_ptr<Node>> failed{std::make_unique<Node>(9)};
+    ASSERT_TRUE(failed.error());
+    EXPECT_EQ((*failed.error())->key, 9);
+    EXPECT_FALSE(failed.data());
+  }
+  EXPECT_EQ(Node::s_destroyed, 2);
+}
+
+TEST(EitherNiche, UNIT_062_SmallPayloadsShareWord)
+{
+  RecordProperty("id", "0.01-UNIT-062");
+  RecordProperty(
+      "desc", "Opted-in small payloads are stored next to the tag byte");
+
+  Either<Void, LookupError> failed{LookupError::EXPIRED};
+  ASSERT_TRUE(failed.error());
+  *failed.error() = LookupError::NOT_FOUND;
+  EXPECT_EQ(*failed.error(), LookupError::NOT_FOUND);
+  EXPECT_FALSE(failed.data());
+
+  Either<std::int32_t, LookupError> value{-7};
+  ASSERT_TRUE(value.data());
+  *value.data() += 1;
+  EXPECT_EQ(*value.data(), -6);
+  EXPECT_FALSE(value.error());
+}
+
+TEST(EitherNiche, UNIT_063_SuspendedHandleSurvivesMove)
+{
+  RecordProperty("id", "0.01-UNIT-063");
+  RecordProperty(
+      "desc", "The tagged handle of a suspended coroutine survives a move");
+
+  Node table{3};
+  std::coroutine_handle<> parked;
+  auto pending = parkedFind(&parked, &table);
+  ASSERT_FALSE(pending.done());
+  EXPECT_FALSE(pending.data());
+  EXPECT_FALSE(pending.error());
+
+  Either<Node*, LookupError> moved{std::move(pending)};
+  ASSERT_FALSE(moved.done());
+
+  parked.resume();
+  ASSERT_TRUE(moved.data());
+  EXPECT_EQ(*moved.data(), &table);
+}
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <cctype>
+#include <gtest/gtest.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "TestHelpers.hpp"
+
+// NOLINTBEGIN(readability-magic-numbers)
+namespace
+{
+auto trim(std::string&& text) -> std::string
+{
+  const auto first = text.find_first_not_of(' ');
+  if (first == std::string::npos)
+    return {};
+  text.erase(text.find_last_not_of(' ') + 1);
+  text.erase(0, first);
+  return std::move(text);
+}
+
+auto checkNotEmpty(std::string&& text) -> Either<std::string, TestError>
+{
+  if (text.empty())
+    return TestError{1, "empty"};
+  return std::move(text);
+}
+
+auto checkShort(std::string&& text) -> Either<std::string, TestError>
+{
+  if (text.size() > 8)
+    return TestError{2, "too long"};
+  return std::move(text);
+}
+} // namespace
+
+TEST(EitherPipe, UNIT_085_StepsAndShortCircuit)
+{
+  RecordProperty("id", "0.01-UNIT-085");
+  RecordProperty(
+      "desc", "pipe mixes plain and Either steps, stopping at the first error");
+
+  int lengthCalls = 0;
+  const auto validate = ropic::pipe(
+      trim,
+      checkNotEmpty,
+      [](std::string&& text)
+      {
+        for (char& c : text)
+          c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        return std::move(text);
+      },
+      checkShort,
+      [&lengthCalls](std::string&& text)
+      {
+        ++lengthCalls;
+        return text.size();
+      });
+
+  auto length = validate(Either<std::string, TestError>{"  ropic "});
+  static_assert(
+      std::is_same_v<decltype(length), Either<std::size_t, TestError>>);
+  EXPECT_EQ(*length.data(), 5U);
+
+  auto empty = validate(Either<std::string, TestError>{"   "});
+  EXPECT_EQ(empty.error()->code, 1);
+
+  auto tooLong = validate(Either<std::string, TestError>{"railway oriented"});
+  EXPECT_EQ(tooLong.error()->code, 2);
+
+  auto failed = validate(Either<std::string, TestError>{TestError{3, "io"}});
+  EXPECT_EQ(failed.error()->message, "io");
+  EXPECT_EQ(lengthCalls, 1);
+
+  // Void steps and Void data
+  int seen = 0;
+  auto unit = ropic::pipe(
+      [&seen](int v) { seen = v; }, [] { return 7; })(Either<int, TestError>{4});
+  EXPECT_EQ(seen, 4);
+  EXPECT_EQ(*unit.data(), 7);
+}
+
+TEST(EitherPipe, UNIT_086_NoIntermediateEither)
+{
+  RecordProperty("id", "0.01-UNIT-086");
+  RecordProperty(
+      "desc", "pipe moves the data only into the final Either, map per step");
+
+  const auto next = [](MoveTracker&& tracker)
+  { return MoveTracker{tracker.value + 1}; };
+
+  MoveTracker::reset();
+  auto chained = Either<int, TestError>{0}
+                     .map([](int v) { return MoveTracker{v}; })
+                     .map(next)
+                     .map(next)
+                     .map(next);
+  EXPECT_EQ(chained.data()->value, 3);
+  EXPECT_EQ(MoveTracker::s_moveCount, 4); // One per intermediate Either
+
+  MoveTracker::reset();
+  auto piped = ropic::pipe([](int v) { return MoveTracker{v}; }, next, next, next)(
+      Either<int, TestError>{0});
+  EXPECT_EQ(piped.data()->value, 3);
+  EXPECT_EQ(MoveTracker::s_moveCount, 1); // Into the result only
+  EXPECT_EQ(MoveTracker::s_copyCount, 0);
+}
+// NOLINTEND(readability-magic-numbers)
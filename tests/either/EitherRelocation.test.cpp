@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <coroutine>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "TestHelpers.hpp"
+
+// NOLINTBEGIN(readability-magic-numbers)
+namespace
+{
+enum class ErrorCode : std::uint8_t
+{
+  MISSING,
+};
+
+/// Counts moves; relocation must not call them.
+struct Counted
+{
+  static int s_moveCount;
+  std::unique_ptr<int> value;
+
+  explicit Counted(int v) : value(std::make_unique<int>(v)) {}
+  Counted(Counted&& other) noexcept : value(std::move(other.value))
+  {
+    ++s_moveCount;
+  }
+  Counted(const Counted&) = delete;
+  auto operator=(Counted&&) noexcept -> Counted& = default;
+  auto operator=(const Counted&) -> Counted& = delete;
+  ~Counted() = default;
+};
+
+int Counted::s_moveCount = 0;
+} // namespace
+
+template <>
+struct ropic::is_trivially_relocatable<Counted> : std::true_type
+{
+};
+
+namespace
+{
+using Row = Either<Counted, ErrorCode>;
+
+static_assert(is_trivially_relocatable_v<int>);
+static_assert(is_trivially_relocatable_v<std::unique_ptr<TestData>>);
+static_assert(is_trivially_relocatable_v<ValueEither<int, ErrorCode>>);
+static_assert(is_trivially_relocatable_v<AsyncEither<TestData, TestError>>);
+static_assert(!is_trivially_relocatable_v<TestData>);
+// A pending Either is pointed at by its promise
+static_assert(!is_trivially_relocatable_v<Row>);
+
+auto load(int key) -> Row
+{
+  if (key < 0)
+    co_return ErrorCode::MISSING;
+  co_return Counted{key};
+}
+
+auto parkedLoad(std::coroutine_handle<>* parked, int key) -> Row
+{
+  co_await ParkingAwaitable{parked};
+  co_return Counted{key};
+}
+} // namespace
+
+TEST(EitherRelocation, UNIT_076_RelocateWithoutMoves)
+{
+  RecordProperty("id", "0.01-UNIT-076");
+  RecordProperty(
+      "desc", "Either ranges relocate bytewise when their payloads allow it");
+
+  std::allocator<Row> allocator;
+  Row* source = allocator.allocate(3);
+  Row* target = allocator.allocate(3);
+  std::construct_at(source, Counted{1});
+  std::construct_at(source + 1, ErrorCode::MISSING);
+  std::construct_at(source + 2, Counted{3});
+
+  Counted::s_moveCount = 0;
+  Row* end = uninitialized_relocate(source, source + 3, target);
+  EXPECT_EQ(end, target + 3);
+  EXPECT_EQ(Counted::s_moveCount, 0);
+  ASSERT_TRUE(target[0].data());
+  EXPECT_EQ(*target[0].data()->value, 1);
+  ASSERT_TRUE(target[1].error());
+  EXPECT_EQ(*target[1].error(), ErrorCode::MISSING);
+  EXPECT_EQ(*target[2].data()->value, 3);
+
+  std::destroy(target, target + 3);
+  allocator.deallocate(source, 3);
+  allocator.deallocate(target, 3);
+}
+
+TEST(EitherRelocation, UNIT_077_PendingEitherFollowsRelocation)
+{
+  RecordProperty("id", "0.01-UNIT-077");
+  RecordProperty(
+      "desc", "A relocated pending Either still receives its coroutine result");
+
+  std::coroutine_handle<> parked;
+  RelocatingVector<Row> rows;
+  rows.push_back(parkedLoad(&parked, 42));
+  ASSERT_FALSE(rows[0].done());
+
+  for (int i = 0; i < 100; ++i)
+    rows.push_back(load(i));
+  EXPECT_GE(rows.capacity(), 101U);
+
+  parked.resume();
+  ASSERT_TRUE(rows[0].data());
+  EXPECT_EQ(*rows[0].data()->value, 42);
+}
+
+TEST(EitherRelocation, UNIT_078_RelocatingVectorGrowth)
+{
+  RecordProperty("id", "0.01-UNIT-078");
+  RecordProperty(
+      "desc", "RelocatingVector grows without moving relocatable Eithers");
+
+  Counted::s_moveCount = 0;
+  RelocatingVector<Row> rows;
+  for (int i = 0; i < 1000; ++i)
+    rows.emplace_back(i % 10 == 0 ? load(-1) : load(i));
+  // Into the result, then into the vector; none on growth
+  EXPECT_EQ(Counted::s_moveCount, 1800);
+  ASSERT_EQ(rows.size(), 1000U);
+
+  int errors = 0;
+  for (Row& row : rows)
+    errors += row.error() ? 1 : 0;
+  EXPECT_EQ(errors, 100);
+  EXPECT_EQ(*rows[999].data()->value, 999);
+
+  rows.pop_back();
+  EXPECT_EQ(rows.size(), 999U);
+
+  // Non-relocatable payloads fall back to move and destroy
+  RelocatingVector<Either<std::string, ErrorCode>> names;
+  for (int i = 0; i < 100; ++i)
+    names.push_back(std::string(40, static_cast<char>('a' + i % 26)));
+  names.reserve(1000);
+  EXPECT_EQ(*names[27].data(), std::string(40, 'b'));
+
+  RelocatingVector<Row> moved{std::move(rows)};
+  EXPECT_TRUE(rows.empty()); // NOLINT(bugprone-use-after-move)
+  EXPECT_EQ(moved.size(), 999U);
+}
+// NOLINTEND(readability-magic-numbers)
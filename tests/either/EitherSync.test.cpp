@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "TestHelpers.hpp"
+
+// NOLINTBEGIN(readability-magic-numbers)
+namespace
+{
+// Same footprint as Either; nothing has to be rebound after relocation
+static_assert(
+    sizeof(SyncEither<std::string, TestError>)
+    == sizeof(Either<std::string, TestError>));
+static_assert(is_trivially_relocatable_v<SyncEither<long, int>>);
+static_assert(
+    std::is_nothrow_move_constructible_v<SyncEither<std::string, TestError>>);
+static_assert(std::is_same_v<SyncEither<void, int>, SyncEither<Void, int>>);
+
+auto parseDigit(char c) -> Either<int, std::string>
+{
+  if (c < '0' || c > '9')
+    return std::string{"not a digit"};
+  return c - '0';
+}
+
+auto syncDigits(std::string text) -> SyncEither<int, std::string>
+{
+  if (text.empty())
+    co_return std::string{"empty"};
+  int value = 0;
+  for (char c : text)
+    value = value * 10 + co_await parseDigit(c);
+  co_return value;
+}
+
+auto syncSum(std::string first, std::string second)
+    -> SyncEither<int, std::string>
+{
+  const int a = co_await syncDigits(std::move(first));
+  auto b = syncDigits(std::move(second));
+  int& value = co_await b;
+  co_return a + value;
+}
+
+auto syncCheck(int value) -> SyncEither<void, std::string>
+{
+  if (value > 100)
+    co_return std::string{"too large"};
+  co_return OK;
+}
+
+auto syncFromEither(int value) -> SyncEither<int, std::string>
+{
+  co_await syncCheck(value);
+  const int doubled = co_await returnData(value * 2);
+  co_return doubled;
+}
+
+auto eitherFromSync(std::string text) -> Either<int, std::string>
+{
+  const int value = co_await syncDigits(std::move(text));
+  co_return value + 1;
+}
+
+auto asyncFromSync(std::string text) -> AsyncEither<int, std::string>
+{
+  const int value = co_await syncDigits(std::move(text));
+  co_return value - 1;
+}
+
+auto checkedHalf(int value) -> ValueEither<int, long>
+{
+  if (value % 2 != 0)
+    return static_cast<long>(value);
+  return value / 2;
+}
+
+auto syncQuarter(int value) -> SyncEither<int, long>
+{
+  const int half = co_await checkedHalf(value);
+  co_return co_await checkedHalf(half);
+}
+
+auto syncInPlace(bool fail) -> SyncEither<std::unique_ptr<int>, TestError>
+{
+  if (fail)
+    co_return in_place_error(7, "in place");
+  co_return in_place(new int{3});
+}
+} // namespace
+
+TEST(EitherSync, UNIT_090_RunsToCompletion)
+{
+  RecordProperty("id", "0.01-UNIT-090");
+  RecordProperty(
+      "desc", "SyncEither coroutines return finished and compose by co_await");
+
+  auto sum = syncSum("12", "30");
+  EXPECT_TRUE(sum.done());
+  ASSERT_TRUE(sum.data());
+  EXPECT_EQ(*sum.data(), 42);
+
+  auto firstFails = syncSum("1x", "30");
+  ASSERT_TRUE(firstFails.error());
+  EXPECT_EQ(*firstFails.error(), "not a digit");
+  EXPECT_FALSE(firstFails.data());
+
+  auto secondFails = syncSum("12", "");
+  ASSERT_TRUE(secondFails.error());
+  EXPECT_EQ(*secondFails.error(), "empty");
+
+  EXPECT_TRUE(syncCheck(1).data());
+  EXPECT_EQ(*syncCheck(101).error(), "too large");
+
+  // Moves only move the payload; a moved-from result keeps its alternative
+  std::vector<SyncEither<int, std::string>> results;
+  for (const char* text : {"7", "8", "", "9"})
+    results.push_back(syncDigits(text));
+  results.reserve(64);
+  EXPECT_EQ(*results[1].data(), 8);
+  EXPECT_EQ(*results[2].error(), "empty");
+
+  auto moved = std::move(results[2]);
+  EXPECT_EQ(*moved.error(), "empty");
+  EXPECT_TRUE(results[2].error()); // NOLINT(bugprone-use-after-move)
+  EXPECT_EQ(std::move(moved).takeError(), "empty");
+
+  auto inPlace = syncInPlace(true);
+  ASSERT_TRUE(inPlace.error());
+  EXPECT_EQ(inPlace.error()->code, 7);
+  EXPECT_EQ(**syncInPlace(false).data(), 3);
+}
+
+TEST(EitherSync, UNIT_091_InteropWithEither)
+{
+  RecordProperty("id", "0.01-UNIT-091");
+  RecordProperty(
+      "desc", "SyncEither awaits Either and is awaited by Either/AsyncEither");
+
+  auto fromEither = syncFromEither(5);
+  ASSERT_TRUE(fromEither.data());
+  EXPECT_EQ(*fromEither.data(), 10);
+  EXPECT_EQ(*syncFromEither(500).error(), "too large");
+
+  auto either = eitherFromSync("41");
+  ASSERT_TRUE(either.data());
+  EXPECT_EQ(*either.data(), 42);
+  EXPECT_EQ(*eitherFromSync("4a").error(), "not a digit");
+
+  auto async = asyncFromSync("43");
+  ASSERT_TRUE(async.done());
+  ASSERT_TRUE(async.data());
+  EXPECT_EQ(*async.data(), 42);
+  auto asyncError = asyncFromSync("");
+  ASSERT_TRUE(asyncError.error());
+  EXPECT_EQ(*asyncError.error(), "empty");
+
+  EXPECT_EQ(*syncQuarter(12).data(), 3);
+  EXPECT_EQ(*syncQuarter(6).error(), 3L);
+
+  // Value mode
+  SyncEither<int, std::string> value{3};
+  EXPECT_EQ(std::move(value).takeData(), 3);
+}
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "TestHelpers.hpp"
+
+// NOLINTBEGIN(readability-magic-numbers)
+namespace
+{
+enum class ParseError : std::uint8_t
+{
+  EMPTY,
+  NOT_A_DIGIT,
+};
+
+auto parseDigit(char c) -> ValueEither<int, ParseError>
+{
+  if (c < '0' || c > '9')
+    return ParseError::NOT_A_DIGIT;
+  return c - '0';
+}
+
+auto checkNotEmpty(const std::string& text) -> Either<void, ParseError>
+{
+  if (text.empty())
+    return ParseError::EMPTY;
+  return OK;
+}
+
+auto parseTwoDigits(const std::string& text) -> Either<int, ParseError>
+{
+  ROPIC_TRY_ASSIGN(Void checked, checkNotEmpty(text));
+  static_cast<void>(checked);
+  ROPIC_TRY_ASSIGN(int tens, parseDigit(text[0]));
+  ROPIC_TRY_ASSIGN(int ones, parseDigit(text.size() > 1 ? text[1] : '?'));
+  return tens * 10 + ones;
+}
+
+auto loadName(int id) -> Either<std::unique_ptr<std::string>, TestError>
+{
+  if (id < 0)
+    return TestError{1, "unknown id"};
+  return std::make_unique<std::string>("user" + std::to_string(id));
+}
+
+#if ROPIC_HAS_TRY_EXPRESSION
+auto sumDigits(const std::string& text) -> ValueEither<int, ParseError>
+{
+  int sum = 0;
+  for (char c : text)
+    sum += ROPIC_TRY(parseDigit(c));
+  return sum;
+}
+
+auto greet(int id) -> Either<std::string, TestError>
+{
+  auto name = ROPIC_TRY(loadName(id));
+  return "hello " + *name;
+}
+#endif
+} // namespace
+
+TEST(EitherTry, UNIT_087_TryAssign)
+{
+  RecordProperty("id", "0.01-UNIT-087");
+  RecordProperty(
+      "desc", "ROPIC_TRY_ASSIGN unwraps data or returns the error early");
+
+  EXPECT_EQ(*parseTwoDigits("42").data(), 42);
+  EXPECT_EQ(*parseTwoDigits("").error(), ParseError::EMPTY);
+  EXPECT_EQ(*parseTwoDigits("4x").error(), ParseError::NOT_A_DIGIT);
+  EXPECT_EQ(*parseTwoDigits("4").error(), ParseError::NOT_A_DIGIT);
+}
+
+#if ROPIC_HAS_TRY_EXPRESSION
+TEST(EitherTry, UNIT_088_TryExpression)
+{
+  RecordProperty("id", "0.01-UNIT-088");
+  RecordProperty(
+      "desc", "ROPIC_TRY unwraps data in expressions, move-only data too");
+
+  EXPECT_EQ(*sumDigits("1234").data(), 10);
+  EXPECT_EQ(*sumDigits("12a4").error(), ParseError::NOT_A_DIGIT);
+
+  EXPECT_EQ(*greet(7).data(), "hello user7");
+  ASSERT_TRUE(greet(-1).error());
+  EXPECT_EQ(greet(-1).error()->message, "unknown id");
+}
+#endif
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string_view>
+#include <type_traits>
+
+#include "TestHelpers.hpp"
+
+// NOLINTBEGIN(readability-magic-numbers)
+namespace
+{
+enum class ErrorCode : std::uint8_t
+{
+  NOT_A_DIGIT,
+  OVERFLOW,
+};
+
+static_assert(std::is_trivially_copyable_v<ValueEither<int, ErrorCode>>);
+static_assert(std::is_trivially_destructible_v<ValueEither<int, ErrorCode>>);
+static_assert(std::is_trivially_copyable_v<ValueEither<Void, ErrorCode>>);
+static_assert(sizeof(ValueEither<int, ErrorCode>) == 2 * sizeof(int));
+
+auto parseDigit(char c) noexcept -> ValueEither<int, ErrorCode>
+{
+  if (c < '0' || c > '9')
+    return ErrorCode::NOT_A_DIGIT;
+  return c - '0';
+}
+
+auto checkRange(int value) noexcept -> ValueEither<Void, ErrorCode>
+{
+  if (value > 999)
+    return ErrorCode::OVERFLOW;
+  return OK;
+}
+
+auto parseNumber(std::string_view text) -> Either<int, ErrorCode>
+{
+  int value = 0;
+  for (const char c : text)
+  {
+    value = value * 10 + co_await parseDigit(c);
+    co_await checkRange(value);
+  }
+  co_return value;
+}
+
+auto parseWithLvalue(char c) -> Either<int, ErrorCode>
+{
+  auto digit = parseDigit(c);
+  int& value = co_await digit;
+  value += 1;
+  co_return *digit.data();
+}
+} // namespace
+
+TEST(EitherValue, UNIT_064_HoldsDataOrError)
+{
+  RecordProperty("id", "0.01-UNIT-064");
+  RecordProperty("desc", "ValueEither holds data or error and copies freely");
+
+  ValueEither<int, ErrorCode> digit = parseDigit('7');
+  ASSERT_TRUE(digit.data());
+  EXPECT_EQ(*digit.data(), 7);
+  EXPECT_FALSE(digit.error());
+  EXPECT_TRUE(digit.done());
+
+  ValueEither<int, ErrorCode> copy = digit;
+  *copy.data() = 8;
+  EXPECT_EQ(*digit.data(), 7);
+  EXPECT_EQ(*copy.data(), 8);
+
+  copy = parseDigit('x');
+  ASSERT_TRUE(copy.error());
+  EXPECT_EQ(*copy.error(), ErrorCode::NOT_A_DIGIT);
+  EXPECT_FALSE(copy.data());
+}
+
+TEST(EitherValue, UNIT_065_AwaitInsideEither)
+{
+  RecordProperty("id", "0.01-UNIT-065");
+  RecordProperty(
+      "desc", "co_await on a ValueEither unwraps data and propagates errors");
+
+  auto number = parseNumber("123");
+  ASSERT_TRUE(number.data());
+  EXPECT_EQ(*number.data(), 123);
+
+  auto notDigit = parseNumber("12a");
+  ASSERT_TRUE(notDigit.error());
+  EXPECT_EQ(*notDigit.error(), ErrorCode::NOT_A_DIGIT);
+
+  auto overflow = parseNumber("12345");
+  ASSERT_TRUE(overflow.error());
+  EXPECT_EQ(*overflow.error(), ErrorCode::OVERFLOW);
+}
+
+TEST(EitherValue, UNIT_066_AwaitLvalue)
+{
+  RecordProperty("id", "0.01-UNIT-066");
+  RecordProperty(
+      "desc", "co_await on a ValueEither lvalue yields a reference to data");
+
+  auto result = parseWithLvalue('4');
+  ASSERT_TRUE(result.data());
+  EXPECT_EQ(*result.data(), 5);
+
+  auto failed = parseWithLvalue('-');
+  ASSERT_TRUE(failed.error());
+  EXPECT_EQ(*failed.error(), ErrorCode::NOT_A_DIGIT);
+}
+// NOLINTEND(readability-magic-numbers)
@@ -6,3 +6,188 @@
 // Static member definitions
 int MoveTracker::s_copyCount = 0;
 int MoveTracker::s_moveCount = 0;
+
+// NOLINTBEGIN(readability-magic-numbers)
+auto returnData(int x) -> Either<int, std::string> { co_return x; }
+
+auto returnError(std::string msg) -> Either<int, std::string>
+{
+  co_return msg;
+}
+
+auto returnOK() -> Either<Void, std::string> { co_return OK; }
+
+auto returnVoidError(std::string msg) -> Either<Void, std::string>
+{
+  co_return msg;
+}
+
+auto awaitAndAdd(Either<int, std::string> input, int delta)
+    -> Either<int, std::string>
+{
+  int val = co_await std::move(input);
+  co_return val + delta;
+}
+
+auto chainedAwaitsAllSucceed(int start) -> Either<int, std::string>
+{
+  int a = co_await returnData(start);
+  int b = co_await returnData(a + 10);
+  int c = co_await returnData(b + 100);
+  co_return c;
+}
+
+auto chainedAwaitsFirstFails() -> Either<int, std::string>
+{
+  int a = co_await returnError("first failed");
+  int b = co_await returnData(a + 10);
+  co_return b;
+}
+
+auto chainedAwaitsMiddleFails(int start) -> Either<int, std::string>
+{
+  [[maybe_unused]]
+  int a = co_await returnData(start);
+  int b = co_await returnError("middle failed");
+  co_return b + 100;
+}
+
+auto innerSuccess(int x) -> Either<int, std::string>
+{
+  co_return x * 2;
+}
+
+auto innerError() -> Either<int, std::string>
+{
+  co_return std::string("inner error");
+}
+
+auto outerCallsInnerSuccess(int x) -> Either<int, std::string>
+{
+  int result = co_await innerSuccess(x);
+  co_return result + 5;
+}
+
+auto outerCallsInnerError() -> Either<int, std::string>
+{
+  int result = co_await innerError();
+  co_return result + 5;
+}
+
+auto mixedTypeCoroutine(int x) -> Either<double, std::string>
+{
+  int val = co_await returnData(x);
+  co_return static_cast<double>(val) * 1.5;
+}
+
+auto validatePositive(int x) -> Either<Void, std::string>
+{
+  if (x <= 0)
+    co_return std::string("must be positive");
+  co_return OK;
+}
+
+auto computeWithValidation(int x) -> Either<int, std::string>
+{
+  co_await validatePositive(x);
+  co_return x * 2;
+}
+
+// Deep nesting (5+ levels)
+
+auto level5(int x) -> Either<int, std::string> { co_return x + 1; }
+
+auto level4(int x) -> Either<int, std::string>
+{
+  int v = co_await level5(x);
+  co_return v + 1;
+}
+
+auto level3(int x) -> Either<int, std::string>
+{
+  int v = co_await level4(x);
+  co_return v + 1;
+}
+
+auto level2(int x) -> Either<int, std::string>
+{
+  int v = co_await level3(x);
+  co_return v + 1;
+}
+
+auto level1(int x) -> Either<int, std::string>
+{
+  int v = co_await level2(x);
+  co_return v + 1;
+}
+
+auto level5Error() -> Either<int, std::string>
+{
+  co_return std::string("deep error");
+}
+
+auto level4Error() -> Either<int, std::string>
+{
+  int v = co_await level5Error();
+  co_return v + 1;
+}
+
+auto level3Error() -> Either<int, std::string>
+{
+  int v = co_await level4Error();
+  co_return v + 1;
+}
+
+auto level2Error() -> Either<int, std::string>
+{
+  int v = co_await level3Error();
+  co_return v + 1;
+}
+
+auto level1Error() -> Either<int, std::string>
+{
+  int v = co_await level2Error();
+  co_return v + 1;
+}
+
+auto returnMoveTracker(int x) -> Either<MoveTracker, std::string>
+{
+  co_return MoveTracker{x};
+}
+
+auto awaitMoveTracker(int x) -> Either<MoveTracker, std::string>
+{
+  MoveTracker val = co_await returnMoveTracker(x);
+  co_return MoveTracker{val.value + 10};
+}
+
+auto returnIntWithMoveTrackerError(bool shouldFail)
+    -> Either<int, MoveTracker>
+{
+  if (shouldFail)
+    co_return MoveTracker{-1};
+  co_return 42;
+}
+
+auto returnNamedMoveTracker(int x) -> Either<MoveTracker, std::string>
+{
+  MoveTracker tracker{x};
+  co_return tracker;
+}
+
+auto returnConstMoveTracker(const MoveTracker& tracker)
+    -> Either<MoveTracker, std::string>
+{
+  co_return tracker;
+}
+
+auto returnMoveTrackerInPlace(int x) -> Either<MoveTracker, std::string>
+{
+  co_return ropic::in_place(x);
+}
+
+auto returnMoveTrackerErrorInPlace(int x) -> Either<int, MoveTracker>
+{
+  co_return ropic::in_place_error(x);
+}
+// NOLINTEND(readability-magic-numbers)
@@ -5,6 +5,8 @@
 
 #include <array>
 #include <climits>
+#include <coroutine>
+#include <memory_resource>
 #include <string>
 
 #include "ropic.hpp"
@@ -74,155 +76,102 @@ struct LargeStruct
   bool operator==(const LargeStruct& other) const = default;
 };
 
-// =============================================================================
-// Helper Coroutines
-// =============================================================================
-
-inline auto returnData(int x) -> Either<int, std::string> { co_return x; }
-inline auto returnError(std::string msg) -> Either<int, std::string>
-{
-  co_return msg;
-}
-inline auto returnOK() -> Either<Void, std::string> { co_return OK; }
-inline auto returnVoidError(std::string msg) -> Either<Void, std::string>
-{
-  co_return msg;
-}
-
-inline auto awaitAndAdd(Either<int, std::string> input, int delta)
-    -> Either<int, std::string>
+/// Memory resource counting the blocks it hands out from an upstream resource.
+class CountingResource : public std::pmr::memory_resource
 {
-  int val = co_await std::move(input);
-  co_return val + delta;
-}
+  std::pmr::memory_resource* _upstream;
 
-inline auto chainedAwaitsAllSucceed(int start) -> Either<int, std::string>
-{
-  int a = co_await returnData(start);
-  int b = co_await returnData(a + 10);
-  int c = co_await returnData(b + 100);
-  co_return c;
-}
+  auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override
+  {
+    ++allocations;
+    return _upstream->allocate(bytes, alignment);
+  }
 
-inline auto chainedAwaitsFirstFails() -> Either<int, std::string>
-{
-  int a = co_await returnError("first failed");
-  int b = co_await returnData(a + 10);
-  co_return b;
-}
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment)
+      override
+  {
+    ++deallocations;
+    _upstream->deallocate(pointer, bytes, alignment);
+  }
 
-inline auto chainedAwaitsMiddleFails(int start) -> Either<int, std::string>
-{
-  [[maybe_unused]]
-  int a = co_await returnData(start);
-  int b = co_await returnError("middle failed");
-  co_return b + 100;
-}
+  [[nodiscard]]
+  auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+      -> bool override
+  {
+    return this == &other;
+  }
 
-inline auto innerSuccess(int x) -> Either<int, std::string>
-{
-  co_return x * 2;
-}
-inline auto innerError() -> Either<int, std::string>
-{
-  co_return std::string("inner error");
-}
+public:
+  int allocations = 0;
+  int deallocations = 0;
 
-inline auto outerCallsInnerSuccess(int x) -> Either<int, std::string>
-{
-  int result = co_await innerSuccess(x);
-  co_return result + 5;
-}
+  explicit CountingResource(
+      std::pmr::memory_resource* upstream =
+          std::pmr::new_delete_resource()) noexcept
+      : _upstream(upstream)
+  {
+  }
+};
 
-inline auto outerCallsInnerError() -> Either<int, std::string>
+/// Foreign awaitable that parks the awaiting coroutine until resumed.
+struct ParkingAwaitable
 {
-  int result = co_await innerError();
-  co_return result + 5;
-}
+  std::coroutine_handle<>* parked;
 
-inline auto mixedTypeCoroutine(int x) -> Either<double, std::string>
-{
-  int val = co_await returnData(x);
-  co_return static_cast<double>(val) * 1.5;
-}
+  [[nodiscard]]
+  auto await_ready() const noexcept -> bool
+  {
+    return false;
+  }
+  void await_suspend(std::coroutine_handle<> handle) noexcept
+  {
+    *parked = handle;
+  }
+  void await_resume() const noexcept {}
+};
 
-inline auto validatePositive(int x) -> Either<Void, std::string>
-{
-  if (x <= 0)
-    co_return std::string("must be positive");
-  co_return OK;
-}
+// =============================================================================
+// Helper Coroutines
+// =============================================================================
 
-inline auto computeWithValidation(int x) -> Either<int, std::string>
-{
-  co_await validatePositive(x);
-  co_return x * 2;
-}
+// Defined in TestHelpers.cpp: GCC lays out each coroutine frame per
+// translation unit, so inline coroutines shared by several tests trip
+// -Wodr when LTO merges them.
+
+auto returnData(int x) -> Either<int, std::string>;
+auto returnError(std::string msg) -> Either<int, std::string>;
+auto returnOK() -> Either<Void, std::string>;
+auto returnVoidError(std::string msg) -> Either<Void, std::string>;
+auto awaitAndAdd(Either<int, std::string> input, int delta)
+    -> Either<int, std::string>;
+auto chainedAwaitsAllSucceed(int start) -> Either<int, std::string>;
+auto chainedAwaitsFirstFails() -> Either<int, std::string>;
+auto chainedAwaitsMiddleFails(int start) -> Either<int, std::string>;
+auto innerSuccess(int x) -> Either<int, std::string>;
+auto innerError() -> Either<int, std::string>;
+auto outerCallsInnerSuccess(int x) -> Either<int, std::string>;
+auto outerCallsInnerError() -> Either<int, std::string>;
+auto mixedTypeCoroutine(int x) -> Either<double, std::string>;
+auto validatePositive(int x) -> Either<Void, std::string>;
+auto computeWithValidation(int x) -> Either<int, std::string>;
 
 // Deep nesting (5+ levels)
-inline auto level5(int x) -> Either<int, std::string> { co_return x + 1; }
-inline auto level4(int x) -> Either<int, std::string>
-{
-  int v = co_await level5(x);
-  co_return v + 1;
-}
-inline auto level3(int x) -> Either<int, std::string>
-{
-  int v = co_await level4(x);
-  co_return v + 1;
-}
-inline auto level2(int x) -> Either<int, std::string>
-{
-  int v = co_await level3(x);
-  co_return v + 1;
-}
-inline auto level1(int x) -> Either<int, std::string>
-{
-  int v = co_await level2(x);
-  co_return v + 1;
-}
-
-inline auto level5Error() -> Either<int, std::string>
-{
-  co_return std::string("deep error");
-}
-inline auto level4Error() -> Either<int, std::string>
-{
-  int v = co_await level5Error();
-  co_return v + 1;
-}
-inline auto level3Error() -> Either<int, std::string>
-{
-  int v = co_await level4Error();
-  co_return v + 1;
-}
-inline auto level2Error() -> Either<int, std::string>
-{
-  int v = co_await level3Error();
-  co_return v + 1;
-}
-inline auto level1Error() -> Either<int, std::string>
-{
-  int v = co_await level2Error();
-  co_return v + 1;
-}
-
-inline auto returnMoveTracker(int x) -> Either<MoveTracker, std::string>
-{
-  co_return MoveTracker{x};
-}
-
-inline auto awaitMoveTracker(int x) -> Either<MoveTracker, std::string>
-{
-  MoveTracker val = co_await returnMoveTracker(x);
-  co_return MoveTracker{val.value + 10};
-}
-
-inline auto returnIntWithMoveTrackerError(bool shouldFail)
-    -> Either<int, MoveTracker>
-{
-  if (shouldFail)
-    co_return MoveTracker{-1};
-  co_return 42;
-}
+auto level5(int x) -> Either<int, std::string>;
+auto level4(int x) -> Either<int, std::string>;
+auto level3(int x) -> Either<int, std::string>;
+auto level2(int x) -> Either<int, std::string>;
+auto level1(int x) -> Either<int, std::string>;
+auto level5Error() -> Either<int, std::string>;
+auto level4Error() -> Either<int, std::string>;
+auto level3Error() -> Either<int, std::string>;
+auto level2Error() -> Either<int, std::string>;
+auto level1Error() -> Either<int, std::string>;
+auto returnMoveTracker(int x) -> Either<MoveTracker, std::string>;
+auto awaitMoveTracker(int x) -> Either<MoveTracker, std::string>;
+auto returnIntWithMoveTrackerError(bool shouldFail) -> Either<int, MoveTracker>;
+auto returnNamedMoveTracker(int x) -> Either<MoveTracker, std::string>;
+auto returnConstMoveTracker(const MoveTracker& tracker)
+    -> Either<MoveTracker, std::string>;
+auto returnMoveTrackerInPlace(int x) -> Either<MoveTracker, std::string>;
+auto returnMoveTrackerErrorInPlace(int x) -> Either<int, MoveTracker>;
 // NOLINTEND(readability-magic-numbers)
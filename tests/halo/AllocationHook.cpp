@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+// =============================================================================
+// Global operator new/delete replacements that count heap allocations.
+// The aligned forms are replaced too: std::pmr::new_delete_resource() uses
+// them for every request.
+// =============================================================================
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "AllocationHook.hpp"
+
+namespace
+{
+std::atomic<std::size_t> s_allocationCount{0};
+} // namespace
+
+auto globalAllocationCount() noexcept -> std::size_t
+{
+  return s_allocationCount.load(std::memory_order_relaxed);
+}
+
+auto operator new(std::size_t size) -> void*
+{
+  s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+  if (void* pointer = std::malloc(size == 0 ? 1 : size))
+    return pointer;
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept
+{
+  std::free(pointer);
+}
+
+auto operator new(std::size_t size, std::align_val_t alignment) -> void*
+{
+  s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+  const auto align = static_cast<std::size_t>(alignment);
+  const std::size_t rounded = (size + align - 1) & ~(align - 1);
+  if (void* pointer = std::aligned_alloc(align, rounded == 0 ? align : rounded))
+    return pointer;
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer, std::align_val_t /*alignment*/) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(
+    void* pointer, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept
+{
+  std::free(pointer);
+}
@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @brief Number of calls to the global operator new since program start.
+ *
+ * The halo-tests executable replaces the global allocation functions (see
+ * AllocationHook.cpp), so every coroutine frame that the compiler does not
+ * elide shows up here.
+ */
+auto globalAllocationCount() noexcept -> std::size_t;
+
+/**
+ * @brief Counts the global allocations made during its lifetime.
+ *
+ * Declared as the first local of a coroutine, it counts every allocation made
+ * by the coroutine body, i.e. the frames of the coroutines it awaits, but not
+ * its own frame. The count is written to `out` when the body ends, including
+ * when an error is propagated out of the coroutine.
+ */
+class NestedAllocations
+{
+  std::size_t& _out;
+  std::size_t _before;
+
+public:
+  explicit NestedAllocations(std::size_t& out) noexcept
+      : _out(out), _before(globalAllocationCount())
+  {
+  }
+
+  NestedAllocations(const NestedAllocations&) = delete;
+  NestedAllocations(NestedAllocations&&) = delete;
+  auto operator=(const NestedAllocations&) -> NestedAllocations& = delete;
+  auto operator=(NestedAllocations&&) -> NestedAllocations& = delete;
+
+  ~NestedAllocations() noexcept { _out = globalAllocationCount() - _before; }
+};
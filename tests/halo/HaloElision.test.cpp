@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 ropic contributors
+
+#include <charconv>
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <string_view>
+
+#include "AllocationHook.hpp"
+#include "ropic.hpp"
+
+using namespace ropic;
+
+// =============================================================================
+// Heap allocation elision (HALO) regression tests
+// =============================================================================
+// Each test counts the global allocations made while a coroutine awaits its
+// callees. With the Clang elision hints and optimizations enabled, every
+// immediately awaited Either must live in its caller's frame, i.e. the count
+// is zero. Elsewhere, each awaited call allocates exactly one frame.
+
+// NOLINTBEGIN(readability-magic-numbers)
+namespace
+{
+#if ROPIC_HAS_CORO_ELISION_HINTS && defined(__OPTIMIZE__)
+constexpr bool ELISION_EXPECTED = true;
+#else
+constexpr bool ELISION_EXPECTED = false;
+#endif
+
+/// @brief Heap frames expected for `awaitedCalls` immediately awaited calls.
+constexpr auto expectedFrames(std::size_t awaitedCalls) -> std::size_t
+{
+  return ELISION_EXPECTED ? 0 : awaitedCalls;
+}
+
+enum class MathError
+{
+  PARSE,
+  DIVIDE_BY_ZERO,
+};
+
+auto parse(std::string_view text) -> Either<double, MathError>
+{
+  double value = 0.0;
+  const auto [end, error] =
+      std::from_chars(text.data(), text.data() + text.size(), value);
+  if (error != std::errc{} || end != text.data() + text.size())
+    co_return MathError::PARSE;
+  co_return value;
+}
+
+auto divide(double numerator, double denominator) -> Either<double, MathError>
+{
+  if (denominator == 0.0)
+    co_return MathError::DIVIDE_BY_ZERO;
+  co_return numerator / denominator;
+}
+
+auto divideStr(
+    std::string_view numerator,
+    std::string_view denominator,
+    std::size_t& nested) -> Either<double, MathError>
+{
+  const NestedAllocations counter{nested};
+  double x = co_await parse(numerator);
+  double y = co_await parse(denominator);
+  double result = co_await divide(x, y);
+  co_return result;
+}
+
+auto halveRepeatedly(double value, int times, std::size_t& nested)
+    -> Either<double, MathError>
+{
+  const NestedAllocations counter{nested};
+  for (int i = 0; i < times; ++i)
+    value = co_await divide(value, 2.0);
+  co_return value;
+}
+
+auto divideTwice(double value) -> Either<double, MathError>
+{
+  double half = co_await divide(value, 2.0);
+  co_return co_await divide(half, 2.0);
+}
+
+auto quarterOf(double value, std::size_t& nested) -> Either<double, MathError>
+{
+  const NestedAllocations counter{nested};
+  co_return co_await divideTwice(value);
+}
+} // namespace
+
+/// Routes frames straight to the global heap so the frame pool cannot hide
+/// allocations that HALO should have removed.
+#define ROPIC_HALO_HEAP_FRAMES()                                               \
+  const FrameResourceScope heapFrames { std::pmr::new_delete_resource() }
+
+TEST(HaloElision, UNIT_044_AwaitedCallsInDivideStr)
+{
+  RecordProperty("id", "0.01-UNIT-044");
+  RecordProperty(
+      "desc", "Immediately awaited parse/divide frames are elided");
+  ROPIC_HALO_HEAP_FRAMES();
+
+  std::size_t nested = 0;
+  auto result = divideStr("10", "4", nested);
+  ASSERT_TRUE(result.data());
+  EXPECT_DOUBLE_EQ(*result.data(), 2.5);
+
+  RecordProperty("allocations", static_cast<int>(nested));
+  EXPECT_EQ(nested, expectedFrames(3));
+}
+
+TEST(HaloElision, UNIT_045_ErrorPropagation)
+{
+  RecordProperty("id", "0.01-UNIT-045");
+  RecordProperty(
+      "desc", "Awaited frames stay elided when an error is propagated");
+  ROPIC_HALO_HEAP_FRAMES();
+
+  std::size_t nested = 0;
+  auto divisionError = divideStr("1", "0", nested);
+  ASSERT_TRUE(divisionError.error());
+  EXPECT_EQ(*divisionError.error(), MathError::DIVIDE_BY_ZERO);
+  EXPECT_EQ(nested, expectedFrames(3));
+
+  auto parseError = divideStr("one", "2", nested);
+  ASSERT_TRUE(parseError.error());
+  EXPECT_EQ(*parseError.error(), MathError::PARSE);
+  EXPECT_EQ(nested, expectedFrames(1));
+}
+
+TEST(HaloElision, UNIT_046_AwaitInLoop)
+{
+  RecordProperty("id", "0.01-UNIT-046");
+  RecordProperty("desc", "A frame awaited in a loop is elided every time");
+  ROPIC_HALO_HEAP_FRAMES();
+
+  std::size_t nested = 0;
+  auto result = halveRepeatedly(1024.0, 10, nested);
+  ASSERT_TRUE(result.data());
+  EXPECT_DOUBLE_EQ(*result.data(), 1.0);
+
+  RecordProperty("allocations", static_cast<int>(nested));
+  EXPECT_EQ(nested, expectedFrames(10));
+}
+
+TEST(HaloElision, UNIT_047_NestedChain)
+{
+  RecordProperty("id", "0.01-UNIT-047");
+  RecordProperty("desc", "Elision composes through nested awaited chains");
+  ROPIC_HALO_HEAP_FRAMES();
+
+  std::size_t nested = 0;
+  auto result = quarterOf(10.0, nested);
+  ASSERT_TRUE(result.data());
+  EXPECT_DOUBLE_EQ(*result.data(), 2.5);
+
+  RecordProperty("allocations", static_cast<int>(nested));
+  EXPECT_EQ(nested, expectedFrames(3));
+}
+// NOLINTEND(readability-magic-numbers)